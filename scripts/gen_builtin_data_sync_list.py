@@ -0,0 +1,398 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import argparse
+import json
+import math
+import re
+import sys
+from fractions import Fraction
+
+r"""
+The script generates a C++ header which has the constexpr table of the
+files and directories listed in the data sync JSON config files so that
+the daemon does not need to parse them at runtime.
+
+The JSON files are validated at build time, against the schema if the
+jsonschema module is available and against the values supported by the
+daemon always.
+"""
+
+ISO_DURATION_NUMBER = r"[0-9]+(?:[.,][0-9]+)?"
+
+ISO_DURATION_REGEX = re.compile(
+    r"^P(?:(?P<weeks>{0})W|(?:(?P<days>{0})D)?"
+    r"(?:T(?:(?P<hours>{0})H)?(?:(?P<minutes>{0})M)?"
+    r"(?:(?P<seconds>{0})S)?)?)$".format(ISO_DURATION_NUMBER)
+)
+
+ISO_DURATION_UNITS_IN_SEC = [
+    ("weeks", 7 * 24 * 60 * 60),
+    ("days", 24 * 60 * 60),
+    ("hours", 60 * 60),
+    ("minutes", 60),
+    ("seconds", 1),
+]
+
+SYNC_DIRECTIONS = ["Active2Passive", "Passive2Active", "Bidirectional"]
+
+SYNC_TYPES = ["Immediate", "Periodic"]
+
+COMPRESSIONS = ["Auto", "Off", "Fast", "Strong"]
+
+# The full sync tier of the least critical data, keep in sync with maxTier
+# in data_sync_config.hpp.
+MAX_TIER = 7
+
+# The maximum bandwidth limit in KiB per second, keep in sync with the type
+# of _bandwidthLimit in builtin_config.hpp.
+MAX_BANDWIDTH_LIMIT = 2**32 - 1
+
+
+class ConfigError(Exception):
+    pass
+
+
+def validate_schema(config_json, schema_file):
+    """API to validate the JSON config against schema.json if the jsonschema
+    module is available.
+
+    Args:
+        config_json : The JSON config
+        schema_file : Path of schema file
+
+    Returns: None
+    """
+
+    try:
+        import jsonschema
+    except ImportError:
+        return
+
+    with open(schema_file) as schema_handle:
+        schema_json = json.load(schema_handle)
+
+    jsonschema.validators.validate(
+        config_json,
+        schema_json,
+        format_checker=jsonschema.Draft202012Validator.FORMAT_CHECKER,
+    )
+
+
+def convert_iso_duration_to_ms(duration):
+    """API to convert the ISO 8601 duration supported by the daemon into
+    milliseconds as the daemon does.
+
+    Args:
+        duration : The duration in ISO 8601 duration format
+                   [PnW or PnDTnHnMnS]
+
+    Returns: The duration in milliseconds
+    """
+
+    match = ISO_DURATION_REGEX.match(duration)
+    components = [
+        (match.group(unit), unit_in_sec)
+        for unit, unit_in_sec in ISO_DURATION_UNITS_IN_SEC
+        if match is not None and match.group(unit) is not None
+    ]
+
+    # At least one component is needed, the time designator must be followed
+    # by a time component and only the last component can have a fraction.
+    if (
+        not components
+        or duration.endswith("T")
+        or any(
+            not value.isdigit() for value, unit_in_sec in components[:-1]
+        )
+    ):
+        raise ConfigError(
+            duration + " is not matching with expected ISO 8601 "
+            "duration format [PnW or PnDTnHnMnS]"
+        )
+
+    # Truncate every component to milliseconds as the daemon does, the
+    # fraction digits beyond the nanoseconds are ignored.
+    total_ms = 0
+    for value, unit_in_sec in components:
+        integer, _, fraction = value.replace(",", ".").partition(".")
+        value = Fraction(integer + "." + fraction[:9] if fraction else integer)
+        total_ms += math.floor(value * unit_in_sec * 1000)
+
+    if total_ms > 2**63 - 1:
+        raise ConfigError(duration + " is too long")
+
+    return total_ms
+
+
+def convert_iso_duration_to_sec(duration):
+    """API to convert the ISO 8601 duration supported by the daemon into
+    seconds, rounded up to the next second as the daemon does.
+
+    Args:
+        duration : The duration in ISO 8601 duration format
+                   [PnW or PnDTnHnMnS]
+
+    Returns: The duration in seconds
+    """
+
+    return math.ceil(Fraction(convert_iso_duration_to_ms(duration), 1000))
+
+
+def cpp_string(value):
+    """API to get the given value as a C++ string_view literal.
+
+    Args:
+        value : The string value
+
+    Returns: The C++ string_view literal
+    """
+
+    return '"' + value.replace("\\", "\\\\").replace('"', '\\"') + '"sv'
+
+
+def cpp_path(key, path):
+    """API to get the given path as a C++ string_view literal.
+
+    Args:
+        key : The key of the path in the config
+        path : The path
+
+    Returns: The C++ string_view literal
+    """
+
+    if not isinstance(path, str) or not path.startswith("/"):
+        raise ConfigError(key + " must have absolute paths")
+    return cpp_string(path)
+
+
+def gen_config(config, index, file_lists):
+    """API to generate the C++ designated initializer of the given file or
+    directory config.
+
+    Args:
+        config : The file or directory config
+        index : The index of the config in the table
+        file_lists : The generated file list arrays to append to
+
+    Returns: The C++ designated initializer
+    """
+
+    for key in ["Path", "Description", "SyncDirection", "SyncType"]:
+        if key not in config:
+            raise ConfigError(key + " is missing")
+
+    if config["SyncDirection"] not in SYNC_DIRECTIONS:
+        raise ConfigError(
+            "Unsupported sync direction [" + config["SyncDirection"] + "]"
+        )
+    if config["SyncType"] not in SYNC_TYPES:
+        raise ConfigError("Unsupported sync type [" + config["SyncType"] + "]")
+
+    # All the members are initialized in the declaration order to keep the
+    # generated header free of the missing initializer warnings.
+    fields = {
+        "_path": cpp_path("Path", config["Path"]),
+        "_syncDirection": "SyncDirection::" + config["SyncDirection"],
+        "_syncType": "SyncType::" + config["SyncType"],
+        "_destPath": '""sv',
+        "_periodicityInSec": "std::nullopt",
+        "_retryAttempts": "std::nullopt",
+        "_retryIntervalInSec": "std::chrono::seconds(0)",
+        "_excludeFileList": "{}",
+        "_includeFileList": "{}",
+        "_tier": "criticalTier",
+        "_maxSyncLatency": "std::nullopt",
+        "_bandwidthLimit": "std::nullopt",
+        "_compression": "Compression::Auto",
+    }
+
+    if "DestinationPath" in config:
+        fields["_destPath"] = cpp_path(
+            "DestinationPath", config["DestinationPath"]
+        )
+
+    if config["SyncType"] == "Periodic":
+        if "Periodicity" not in config:
+            raise ConfigError("Periodicity is missing for the periodic sync")
+        fields["_periodicityInSec"] = (
+            "std::chrono::seconds("
+            + str(convert_iso_duration_to_sec(config["Periodicity"]))
+            + ")"
+        )
+    elif "Periodicity" in config:
+        raise ConfigError("Periodicity is allowed only for the periodic sync")
+
+    if ("RetryAttempts" in config) != ("RetryInterval" in config):
+        raise ConfigError(
+            "RetryAttempts and RetryInterval must be configured together"
+        )
+    if "RetryAttempts" in config:
+        retry_attempts = config["RetryAttempts"]
+        if not isinstance(retry_attempts, int) or not (
+            0 <= retry_attempts <= 255
+        ):
+            raise ConfigError("RetryAttempts must be in the range [0, 255]")
+        fields["_retryAttempts"] = str(retry_attempts)
+        fields["_retryIntervalInSec"] = (
+            "std::chrono::seconds("
+            + str(convert_iso_duration_to_sec(config["RetryInterval"]))
+            + ")"
+        )
+
+    if "Tier" in config:
+        tier = config["Tier"]
+        if not isinstance(tier, int) or not (0 <= tier <= MAX_TIER):
+            raise ConfigError(
+                "Tier must be in the range [0, " + str(MAX_TIER) + "]"
+            )
+        fields["_tier"] = str(tier)
+
+    if "MaxSyncLatency" in config:
+        fields["_maxSyncLatency"] = (
+            "std::chrono::milliseconds("
+            + str(convert_iso_duration_to_ms(config["MaxSyncLatency"]))
+            + ")"
+        )
+
+    if "BandwidthLimit" in config:
+        bandwidth_limit = config["BandwidthLimit"]
+        if not isinstance(bandwidth_limit, int) or not (
+            1 <= bandwidth_limit <= MAX_BANDWIDTH_LIMIT
+        ):
+            raise ConfigError(
+                "BandwidthLimit must be in the range [1, "
+                + str(MAX_BANDWIDTH_LIMIT)
+                + "]"
+            )
+        fields["_bandwidthLimit"] = str(bandwidth_limit)
+
+    if "Compression" in config:
+        if config["Compression"] not in COMPRESSIONS:
+            raise ConfigError(
+                "Unsupported compression [" + config["Compression"] + "]"
+            )
+        fields["_compression"] = "Compression::" + config["Compression"]
+
+    for key, member in [
+        ("ExcludeFilesList", "_excludeFileList"),
+        ("IncludeFilesList", "_includeFileList"),
+    ]:
+        if key not in config:
+            continue
+        if not config[key]:
+            raise ConfigError(key + " must not be empty")
+        array_name = member[1:] + str(index)
+        paths = [cpp_path(key, path) for path in config[key]]
+        file_lists.append(
+            "inline constexpr std::array<std::string_view, "
+            + str(len(paths))
+            + "> "
+            + array_name
+            + "{\n    "
+            + ",\n    ".join(paths)
+            + "};\n"
+        )
+        fields[member] = array_name
+
+    return (
+        "    {"
+        + ",\n     ".join(
+            "." + member + " = " + value for member, value in fields.items()
+        )
+        + "}"
+    )
+
+
+def gen_header(data_sync_list, schema_file):
+    """API to generate the C++ header from the JSON config files.
+
+    Args:
+        data_sync_list : List of JSON config files
+        schema_file : Path of schema file
+
+    Returns: The C++ header content
+    """
+
+    configs = []
+    file_lists = []
+
+    for config_file in data_sync_list:
+        try:
+            with open(config_file) as config_file_handle:
+                config_file_json = json.load(config_file_handle)
+
+            validate_schema(config_file_json, schema_file)
+
+            for key in ["Files", "Directories"]:
+                for config in config_file_json.get(key, []):
+                    configs.append(
+                        gen_config(config, len(configs), file_lists)
+                    )
+        except Exception as error:
+            sys.exit(
+                "Failed to generate the builtin config from "
+                + config_file
+                + "!!! Error : "
+                + str(error)
+            )
+
+    header = [
+        "// SPDX-License-Identifier: Apache-2.0\n",
+        "// This file is generated by gen_builtin_data_sync_list.py. "
+        "Do not edit.\n",
+        "#pragma once\n",
+        '#include "builtin_config.hpp"\n',
+        "#include <array>\n#include <string_view>\n",
+        "namespace data_sync::config::builtin\n{\n",
+        "using namespace std::string_view_literals;\n",
+    ]
+    header.extend(file_lists)
+    header.append(
+        "inline constexpr std::array<BuiltinConfig, "
+        + str(len(configs))
+        + "> dataSyncList{{\n"
+        + ",\n".join(configs)
+        + ("\n" if configs else "")
+        + "}};\n"
+    )
+    header.append("} // namespace data_sync::config::builtin\n")
+
+    return "\n".join(header)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Data sync builtin config table generator"
+    )
+
+    parser.add_argument(
+        "-s",
+        "--schema",
+        dest="schema_file",
+        help="The data sync config JSON's schema file",
+        required=True,
+    )
+
+    parser.add_argument(
+        "-o",
+        "--output",
+        dest="output_file",
+        help="The generated C++ header file",
+        required=True,
+    )
+
+    parser.add_argument(
+        "-f",
+        "--json_files",
+        nargs="*",
+        dest="data_sync_list",
+        default=[],
+        help="The data sync JSON config files to build in",
+    )
+
+    args = parser.parse_args()
+
+    header = gen_header(args.data_sync_list, args.schema_file)
+
+    with open(args.output_file, "w") as output_handle:
+        output_handle.write(header)
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "builtin_config.hpp"
+
+#include "builtin_data_sync_list.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+
+namespace data_sync::config
+{
+
+namespace
+{
+
+/**
+ * @brief A helper API to normalize the given path to compare the configured
+ *        paths regardless of the trailing slash.
+ */
+std::filesystem::path normalize(std::string_view path)
+{
+    auto normalPath = std::filesystem::path(path).lexically_normal();
+    if (!normalPath.has_filename() && normalPath.has_parent_path() &&
+        normalPath != normalPath.root_path())
+    {
+        normalPath = normalPath.parent_path();
+    }
+    return normalPath;
+}
+
+} // namespace
+
+DataSyncConfig toDataSyncConfig(const BuiltinConfig& builtinCfg)
+{
+    DataSyncConfig dataSyncCfg;
+    dataSyncCfg._path = builtinCfg._path;
+    dataSyncCfg._syncDirection = builtinCfg._syncDirection;
+    dataSyncCfg._syncType = builtinCfg._syncType;
+    dataSyncCfg._periodicityInSec = builtinCfg._periodicityInSec;
+
+    if (!builtinCfg._destPath.empty())
+    {
+        dataSyncCfg._destPath = std::string(builtinCfg._destPath);
+    }
+
+    if (builtinCfg._retryAttempts.has_value())
+    {
+        dataSyncCfg._retry = Retry(*builtinCfg._retryAttempts,
+                                   builtinCfg._retryIntervalInSec);
+    }
+
+    if (!builtinCfg._excludeFileList.empty())
+    {
+        dataSyncCfg._excludeFileList.emplace(
+            builtinCfg._excludeFileList.begin(),
+            builtinCfg._excludeFileList.end());
+    }
+
+    if (!builtinCfg._includeFileList.empty())
+    {
+        dataSyncCfg._includeFileList.emplace(
+            builtinCfg._includeFileList.begin(),
+            builtinCfg._includeFileList.end());
+    }
+
+    dataSyncCfg._tier = builtinCfg._tier;
+    dataSyncCfg._maxSyncLatency = builtinCfg._maxSyncLatency;
+    dataSyncCfg._bandwidthLimit = builtinCfg._bandwidthLimit;
+    dataSyncCfg._compression = builtinCfg._compression;
+
+    return dataSyncCfg;
+}
+
+std::span<const BuiltinConfig> getBuiltinConfigs()
+{
+    return builtin::dataSyncList;
+}
+
+void mergeBuiltinConfigs(std::span<const BuiltinConfig> builtinCfgs,
+                         std::vector<DataSyncConfig>& dataSyncCfgs)
+{
+    std::vector<DataSyncConfig> mergedCfgs;
+    mergedCfgs.reserve(builtinCfgs.size() + dataSyncCfgs.size());
+
+    for (const auto& builtinCfg : builtinCfgs)
+    {
+        auto builtinPath = normalize(builtinCfg._path);
+        if (std::ranges::any_of(dataSyncCfgs,
+                                [&builtinPath](const auto& dataSyncCfg) {
+            return normalize(dataSyncCfg._path) == builtinPath;
+        }))
+        {
+            lg2::info("The builtin configuration of the path [{PATH}] is "
+                      "overridden by the configuration directory",
+                      "PATH", builtinCfg._path);
+            continue;
+        }
+        mergedCfgs.emplace_back(toDataSyncConfig(builtinCfg));
+    }
+
+    std::ranges::move(dataSyncCfgs, std::back_inserter(mergedCfgs));
+    dataSyncCfgs = std::move(mergedCfgs);
+}
+
+} // namespace data_sync::config
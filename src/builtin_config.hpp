@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace data_sync::config
+{
+
+/**
+ * @brief The structure contains the data sync configuration of a file or
+ *        directory which is compiled into the daemon from the data sync JSON
+ *        configuration files at build time.
+ *
+ * @note The table of these configurations is generated by the script
+ *       gen_builtin_data_sync_list.py and it is validated at build time.
+ */
+struct BuiltinConfig
+{
+    /**
+     * @brief The file or directory path to be synchronized.
+     */
+    std::string_view _path;
+
+    /**
+     * @brief The sync direction.
+     */
+    SyncDirection _syncDirection{SyncDirection::Active2Passive};
+
+    /**
+     * @brief The sync type.
+     */
+    SyncType _syncType{SyncType::Immediate};
+
+    /**
+     * @brief The destination path.
+     *
+     * @note Empty if the destination path is not configured.
+     */
+    std::string_view _destPath;
+
+    /**
+     * @brief The interval (in seconds) to sync periodically.
+     */
+    std::optional<std::chrono::seconds> _periodicityInSec;
+
+    /**
+     * @brief The number of retries if configured.
+     */
+    std::optional<uint8_t> _retryAttempts;
+
+    /**
+     * @brief The retry interval in seconds.
+     *
+     * @note Valid only if the number of retries is configured.
+     */
+    std::chrono::seconds _retryIntervalInSec{0};
+
+    /**
+     * @brief The list of paths to exclude from synchronization.
+     *
+     * @note Empty if the exclude list is not configured.
+     */
+    std::span<const std::string_view> _excludeFileList;
+
+    /**
+     * @brief The list of paths to include from synchronization.
+     *
+     * @note Empty if the include list is not configured.
+     */
+    std::span<const std::string_view> _includeFileList;
+
+    /**
+     * @brief The full sync tier.
+     */
+    std::uint8_t _tier{criticalTier};
+
+    /**
+     * @brief The maximum latency to sync the changed data if configured.
+     */
+    std::optional<std::chrono::milliseconds> _maxSyncLatency;
+
+    /**
+     * @brief The bandwidth limit in KiB per second if configured.
+     */
+    std::optional<std::uint32_t> _bandwidthLimit;
+
+    /**
+     * @brief The compression policy of the transfer.
+     */
+    Compression _compression{Compression::Auto};
+};
+
+/**
+ * @brief Convert the given builtin configuration into the data sync
+ *        configuration.
+ *
+ * @param[in] builtinCfg - The builtin configuration
+ *
+ * @return The data sync configuration
+ */
+DataSyncConfig toDataSyncConfig(const BuiltinConfig& builtinCfg);
+
+/**
+ * @brief Get the data sync configurations which are compiled into the daemon.
+ *
+ * @return The builtin configurations, empty if the daemon is not built with
+ *         the builtin_config option.
+ */
+std::span<const BuiltinConfig> getBuiltinConfigs();
+
+/**
+ * @brief Merge the given builtin configurations into the configurations
+ *        parsed from the configuration directory at runtime.
+ *
+ * @param[in] builtinCfgs - The builtin configurations
+ * @param[in,out] dataSyncCfgs - The runtime configurations which get the
+ *                               builtin configurations prepended
+ *
+ * @note The runtime configuration of the same path overrides the builtin
+ *       configuration.
+ */
+void mergeBuiltinConfigs(std::span<const BuiltinConfig> builtinCfgs,
+                         std::vector<DataSyncConfig>& dataSyncCfgs);
+
+} // namespace data_sync::config
@@ -0,0 +1,471 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "change_journal.hpp"
+
+#include "fnv1a.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace data_sync
+{
+
+namespace
+{
+
+/**
+ * @brief The journal file format identifier.
+ */
+constexpr std::array<char, 8> journalMagic{'P', 'D', 'S', 'J', 'R', 'N', 'L',
+                                           0};
+
+/**
+ * @brief The journal file format version, must be bumped whenever the layout
+ *        of the header or the records change.
+ */
+constexpr std::uint32_t journalVersion = 1;
+
+/**
+ * @brief The minimum number of the appended records to compact the journal.
+ */
+constexpr std::size_t minCompactionRecords = 1024;
+
+/**
+ * @brief The header of the journal file.
+ */
+struct JournalHeader
+{
+    std::array<char, 8> _magic;
+    std::uint32_t _version;
+    std::array<char, 40> _bootId;
+};
+
+/**
+ * @brief The fixed size part of the journal record, it is followed by
+ *        the path and the hash of the record.
+ */
+struct [[gnu::packed]] RecordHeader
+{
+    std::uint32_t _pathSize;
+    std::uint8_t _type;
+    std::uint64_t _sequence;
+};
+
+/**
+ * @brief A helper API to make the journal header of the current boot.
+ */
+JournalHeader makeHeader()
+{
+    JournalHeader header{journalMagic, journalVersion, {}};
+    auto bootId = ChangeJournal::bootId();
+    std::ranges::copy_n(bootId.begin(),
+                        std::min(bootId.size(), header._bootId.size()),
+                        header._bootId.begin());
+    return header;
+}
+
+/**
+ * @brief A helper API to write all the given data into the given file.
+ *
+ * @return True if written; otherwise False.
+ */
+bool writeAll(int fd, std::string_view data)
+{
+    while (!data.empty())
+    {
+        auto written = write(fd, data.data(), data.size());
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data.remove_prefix(static_cast<std::size_t>(written));
+    }
+    return true;
+}
+
+} // namespace
+
+ChangeJournal::ChangeJournal(const fs::path& journalFile) :
+    _journalFile(journalFile)
+{}
+
+ChangeJournal::~ChangeJournal()
+{
+    // Commit the records which are waiting for the group commit.
+    commit();
+    if (_fd >= 0)
+    {
+        close(_fd);
+    }
+}
+
+std::string ChangeJournal::bootId()
+{
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::string bootId;
+    std::getline(file, bootId);
+    return bootId;
+}
+
+bool ChangeJournal::load(ChangeLog& changeLog)
+{
+    std::ifstream file(_journalFile, std::ios::binary);
+    if (!file.is_open())
+    {
+        lg2::info("No change journal {JOURNAL} to restore", "JOURNAL",
+                  _journalFile);
+        return false;
+    }
+    std::string data{std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>()};
+
+    JournalHeader header{};
+    if (data.size() < sizeof(header))
+    {
+        lg2::info("Ignoring the empty change journal {JOURNAL}", "JOURNAL",
+                  _journalFile);
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header._magic != journalMagic || header._version != journalVersion)
+    {
+        lg2::info("Ignoring the outdated or corrupted change journal "
+                  "{JOURNAL}",
+                  "JOURNAL", _journalFile);
+        return false;
+    }
+
+    bool intact = true;
+    std::size_t records = 0;
+    std::map<std::string, std::uint64_t, std::less<>> shutdownPaths;
+    std::string_view remaining{data};
+    remaining.remove_prefix(sizeof(header));
+    while (!remaining.empty())
+    {
+        RecordHeader record{};
+        std::uint64_t hash{0};
+        if (remaining.size() < sizeof(record))
+        {
+            intact = false;
+            break;
+        }
+        std::memcpy(&record, remaining.data(), sizeof(record));
+
+        auto recordSize = sizeof(record) + record._pathSize;
+        if (remaining.size() - sizeof(record) < record._pathSize ||
+            remaining.size() - recordSize < sizeof(hash))
+        {
+            intact = false;
+            break;
+        }
+        std::memcpy(&hash, remaining.substr(recordSize).data(), sizeof(hash));
+        if (hash != fnv1a(remaining.substr(0, recordSize)))
+        {
+            intact = false;
+            break;
+        }
+
+        std::string path{remaining.substr(sizeof(record), record._pathSize)};
+        ChangeLog::Sequence sequence = record._sequence;
+
+        // The data may be changed after the shutdown if anything is
+        // journaled after it.
+        auto type = static_cast<RecordType>(record._type);
+        if (type != RecordType::shutdownPath && type != RecordType::shutdown)
+        {
+            _shutdownFingerprints.reset();
+            shutdownPaths.clear();
+        }
+        switch (type)
+        {
+            case RecordType::change:
+                changeLog.restore(path, sequence);
+                break;
+            case RecordType::confirm:
+                changeLog.confirm(path, sequence);
+                break;
+            case RecordType::overflow:
+                changeLog.markOverflowed();
+                break;
+            case RecordType::fullSync:
+                _fullSyncFingerprint = sequence;
+                _fullSyncCheckpoint.reset();
+                break;
+            case RecordType::fullSyncStart:
+                _fullSyncCheckpoint.emplace()._cfgFingerprint = sequence;
+                break;
+            case RecordType::fullSyncPath:
+                if (_fullSyncCheckpoint.has_value())
+                {
+                    _fullSyncCheckpoint->_syncedPaths.insert_or_assign(
+                        std::move(path), sequence);
+                }
+                break;
+            case RecordType::shutdownPath:
+                shutdownPaths.insert_or_assign(std::move(path), sequence);
+                break;
+            case RecordType::shutdown:
+                _shutdownFingerprints = std::exchange(shutdownPaths, {});
+                break;
+            default:
+                intact = false;
+                break;
+        }
+        if (!intact)
+        {
+            break;
+        }
+
+        remaining.remove_prefix(recordSize + sizeof(hash));
+        ++records;
+    }
+    _appendedRecords = records;
+
+    if (!intact)
+    {
+        lg2::warning("The change journal {JOURNAL} is torn after {COUNT} "
+                     "records",
+                     "JOURNAL", _journalFile, "COUNT", records);
+        return false;
+    }
+
+    if (header._bootId != makeHeader()._bootId)
+    {
+        lg2::info("The change journal {JOURNAL} is of the previous boot",
+                  "JOURNAL", _journalFile);
+        return false;
+    }
+    return true;
+}
+
+void ChangeJournal::logChange(const std::string& path,
+                              ChangeLog::Sequence sequence)
+{
+    append(RecordType::change, sequence, path);
+}
+
+void ChangeJournal::logConfirm(const std::string& cfgPath,
+                               ChangeLog::Sequence sequence)
+{
+    append(RecordType::confirm, sequence, cfgPath);
+}
+
+void ChangeJournal::logOverflow()
+{
+    if (!std::exchange(_overflowLogged, true))
+    {
+        append(RecordType::overflow, 0, {});
+    }
+}
+
+void ChangeJournal::logFullSync(std::uint64_t cfgFingerprint)
+{
+    _fullSyncFingerprint = cfgFingerprint;
+    _fullSyncCheckpoint.reset();
+    append(RecordType::fullSync, cfgFingerprint, {});
+}
+
+void ChangeJournal::logFullSyncStart(std::uint64_t cfgFingerprint)
+{
+    _fullSyncCheckpoint.emplace()._cfgFingerprint = cfgFingerprint;
+    append(RecordType::fullSyncStart, cfgFingerprint, {});
+}
+
+void ChangeJournal::logFullSyncPath(const std::string& cfgPath,
+                                    std::uint64_t sourceFingerprint)
+{
+    if (_fullSyncCheckpoint.has_value())
+    {
+        _fullSyncCheckpoint->_syncedPaths.insert_or_assign(cfgPath,
+                                                          sourceFingerprint);
+    }
+    append(RecordType::fullSyncPath, sourceFingerprint, cfgPath);
+}
+
+void ChangeJournal::logShutdown(
+    const std::map<std::string, std::uint64_t, std::less<>>&
+        sourceFingerprints)
+{
+    for (const auto& [cfgPath, sourceFingerprint] : sourceFingerprints)
+    {
+        append(RecordType::shutdownPath, sourceFingerprint, cfgPath);
+    }
+
+    // The fingerprints are complete only if the end of them is journaled.
+    append(RecordType::shutdown, 0, {});
+}
+
+void ChangeJournal::append(RecordType type, ChangeLog::Sequence sequence,
+                           const std::string& path)
+{
+    RecordHeader record{static_cast<std::uint32_t>(path.size()),
+                        static_cast<std::uint8_t>(type), sequence};
+
+    auto offset = _buffer.size();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _buffer.append(reinterpret_cast<const char*>(&record), sizeof(record));
+    _buffer.append(path);
+
+    auto hash = fnv1a(std::string_view{_buffer}.substr(offset));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _buffer.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    ++_appendedRecords;
+}
+
+bool ChangeJournal::open()
+{
+    if (_fd >= 0)
+    {
+        return true;
+    }
+
+    std::error_code ec;
+    fs::create_directories(_journalFile.parent_path(), ec);
+
+    _fd = ::open(_journalFile.c_str(),
+                 O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if (_fd < 0)
+    {
+        lg2::error("Failed to open the change journal {JOURNAL}, errno: "
+                   "{ERRNO}",
+                   "JOURNAL", _journalFile, "ERRNO", errno);
+        return false;
+    }
+
+    // The new journal starts with the header.
+    if (lseek(_fd, 0, SEEK_END) == 0)
+    {
+        auto header = makeHeader();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (!writeAll(_fd, {reinterpret_cast<const char*>(&header),
+                            sizeof(header)}))
+        {
+            close(_fd);
+            _fd = -1;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ChangeJournal::commit()
+{
+    if (_buffer.empty())
+    {
+        return true;
+    }
+
+    if (!open() || !writeAll(_fd, _buffer) || fdatasync(_fd) != 0)
+    {
+        lg2::error("Failed to commit the change journal {JOURNAL}, errno: "
+                   "{ERRNO}",
+                   "JOURNAL", _journalFile, "ERRNO", errno);
+        return false;
+    }
+    _buffer.clear();
+    return true;
+}
+
+bool ChangeJournal::needsCompaction() const
+{
+    return _appendedRecords >=
+           std::max(minCompactionRecords, 2 * _snapshotRecords);
+}
+
+bool ChangeJournal::compact(const ChangeLog& changeLog)
+{
+    // The snapshot covers the records which are not committed yet.
+    _buffer.clear();
+    _appendedRecords = 0;
+    _overflowLogged = false;
+
+    if (_fullSyncFingerprint.has_value())
+    {
+        append(RecordType::fullSync, *_fullSyncFingerprint, {});
+    }
+    if (_fullSyncCheckpoint.has_value())
+    {
+        append(RecordType::fullSyncStart, _fullSyncCheckpoint->_cfgFingerprint,
+               {});
+        for (const auto& [cfgPath, sourceFingerprint] :
+             _fullSyncCheckpoint->_syncedPaths)
+        {
+            append(RecordType::fullSyncPath, sourceFingerprint, cfgPath);
+        }
+    }
+    if (changeLog.overflowed())
+    {
+        logOverflow();
+    }
+    for (const auto& [cfgPath, sequence] : changeLog.highWaterMarks())
+    {
+        logConfirm(cfgPath, sequence);
+    }
+    for (const auto& [path, sequence] : changeLog.changes())
+    {
+        logChange(path, sequence);
+    }
+
+    auto header = makeHeader();
+    std::string snapshot;
+    snapshot.reserve(sizeof(header) + _buffer.size());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    snapshot.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    snapshot.append(_buffer);
+
+    // Write into a temporary file and rename it to replace the journal
+    // atomically.
+    auto tmpJournalFile = _journalFile;
+    tmpJournalFile += ".tmp";
+
+    std::error_code ec;
+    fs::create_directories(_journalFile.parent_path(), ec);
+    int fd = ::open(tmpJournalFile.c_str(),
+                    O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    bool written = fd >= 0 && writeAll(fd, snapshot) && fsync(fd) == 0;
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    if (written)
+    {
+        fs::rename(tmpJournalFile, _journalFile, ec);
+    }
+    if (!written || ec)
+    {
+        lg2::error("Failed to compact the change journal {JOURNAL}",
+                   "JOURNAL", _journalFile);
+        fs::remove(tmpJournalFile, ec);
+
+        // Keep the snapshot to append into the current journal.
+        return false;
+    }
+
+    _buffer.clear();
+    _snapshotRecords = std::exchange(_appendedRecords, 0);
+
+    // Append the next records into the compacted journal.
+    if (_fd >= 0)
+    {
+        close(_fd);
+        _fd = -1;
+    }
+    return true;
+}
+
+} // namespace data_sync
@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "change_log.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace data_sync
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The structure contains the progress of the full sync which is not
+ *        completed yet.
+ */
+struct FullSyncCheckpoint
+{
+    /**
+     * @brief The fingerprint of the configuration which is fully synced.
+     */
+    std::uint64_t _cfgFingerprint{0};
+
+    /**
+     * @brief The fingerprint of the source data of each synced configured
+     *        path when it is synced.
+     */
+    std::map<std::string, std::uint64_t, std::less<>> _syncedPaths;
+};
+
+/**
+ * @class ChangeJournal
+ *
+ * @brief The class persists the change log into an append-only journal so
+ *        that the pending changes survive the daemon restarts.
+ *
+ *        - The changes and the confirmations are buffered and committed
+ *          together by a single write and sync of the journal.
+ *        - Each record is checksummed, a torn or corrupted tail is dropped
+ *          while loading.
+ *        - The journal is compacted into a snapshot of the change log once
+ *          it is mostly the confirmed records.
+ *        - The progress of the full sync is checkpointed to resume it.
+ *        - The journal records the boot it is created in, the change log is
+ *          complete only if it is loaded in the same boot as the changes
+ *          made while the daemon is down are not logged.
+ *        - The fingerprints of the source data are journaled once the
+ *          daemon is stopped gracefully, to find the data changed while it
+ *          is down in the same boot.
+ */
+class ChangeJournal
+{
+  public:
+    ChangeJournal(const ChangeJournal&) = delete;
+    ChangeJournal& operator=(const ChangeJournal&) = delete;
+    ChangeJournal(ChangeJournal&&) = delete;
+    ChangeJournal& operator=(ChangeJournal&&) = delete;
+    ~ChangeJournal();
+
+    /**
+     * @brief The constructor of the journal.
+     *
+     * @param[in] journalFile - The journal file
+     */
+    explicit ChangeJournal(const fs::path& journalFile);
+
+    /**
+     * @brief Restore the journaled changes into the given change log.
+     *
+     * @param[in,out] changeLog - The change log to restore
+     *
+     * @return True if the journal is intact and created in the current boot,
+     *         that is, the restored log is complete; otherwise False.
+     *
+     * @note The valid records are restored even if it returns False.
+     */
+    bool load(ChangeLog& changeLog);
+
+    /**
+     * @brief Journal the change of the given path.
+     *
+     * @param[in] path - The changed path
+     * @param[in] sequence - The sequence number of the change
+     */
+    void logChange(const std::string& path, ChangeLog::Sequence sequence);
+
+    /**
+     * @brief Journal the confirmation of the given configured path.
+     *
+     * @param[in] cfgPath - The configured path
+     * @param[in] sequence - The confirmed sequence
+     */
+    void logConfirm(const std::string& cfgPath, ChangeLog::Sequence sequence);
+
+    /**
+     * @brief Journal the overflow of the change log.
+     */
+    void logOverflow();
+
+    /**
+     * @brief Journal the completion of the full sync.
+     *
+     * @param[in] cfgFingerprint - The fingerprint of the configuration which
+     *                             is fully synced
+     */
+    void logFullSync(std::uint64_t cfgFingerprint);
+
+    /**
+     * @brief Journal the start of the full sync from the beginning.
+     *
+     * @param[in] cfgFingerprint - The fingerprint of the configuration which
+     *                             is going to be fully synced
+     */
+    void logFullSyncStart(std::uint64_t cfgFingerprint);
+
+    /**
+     * @brief Journal the configured path which is synced by the full sync.
+     *
+     * @param[in] cfgPath - The configured path
+     * @param[in] sourceFingerprint - The fingerprint of the source data when
+     *                                it is synced
+     */
+    void logFullSyncPath(const std::string& cfgPath,
+                         std::uint64_t sourceFingerprint);
+
+    /**
+     * @brief Journal the fingerprints of the source data once the daemon is
+     *        stopped gracefully.
+     *
+     * @param[in] sourceFingerprints - The fingerprint of the source data of
+     *                                 each configured path
+     */
+    void logShutdown(
+        const std::map<std::string, std::uint64_t, std::less<>>&
+            sourceFingerprints);
+
+    /**
+     * @brief Get the fingerprints of the source data when the daemon is
+     *        stopped last time.
+     *
+     * @return The fingerprints if the daemon is stopped gracefully and
+     *         nothing is journaled after that; otherwise, std::nullopt.
+     */
+    const std::optional<std::map<std::string, std::uint64_t, std::less<>>>&
+        shutdownFingerprints() const
+    {
+        return _shutdownFingerprints;
+    }
+
+    /**
+     * @brief Get the progress of the full sync which is not completed yet.
+     */
+    const std::optional<FullSyncCheckpoint>& fullSyncCheckpoint() const
+    {
+        return _fullSyncCheckpoint;
+    }
+
+    /**
+     * @brief Get the fingerprint of the configuration of the last completed
+     *        full sync.
+     */
+    std::optional<std::uint64_t> fullSyncFingerprint() const
+    {
+        return _fullSyncFingerprint;
+    }
+
+    /**
+     * @brief Write and sync the journaled records which are not committed.
+     *
+     * @return True if committed; otherwise False.
+     */
+    bool commit();
+
+    /**
+     * @brief Check whether the journal has the records to commit.
+     */
+    bool hasPendingRecords() const
+    {
+        return !_buffer.empty();
+    }
+
+    /**
+     * @brief Check whether the journal is worth compacting.
+     */
+    bool needsCompaction() const;
+
+    /**
+     * @brief Replace the journal by the snapshot of the given change log.
+     *
+     * @param[in] changeLog - The change log
+     *
+     * @return True if compacted; otherwise False.
+     */
+    bool compact(const ChangeLog& changeLog);
+
+    /**
+     * @brief Get the id of the current boot.
+     */
+    static std::string bootId();
+
+  private:
+    /**
+     * @brief The type of the journal record.
+     */
+    enum class RecordType : std::uint8_t
+    {
+        change = 1,
+        confirm = 2,
+        overflow = 3,
+        fullSync = 4,
+        fullSyncStart = 5,
+        fullSyncPath = 6,
+        shutdownPath = 7,
+        shutdown = 8
+    };
+
+    /**
+     * @brief A helper API to encode a record into the buffer.
+     *
+     * @param[in] type - The record type
+     * @param[in] sequence - The sequence number
+     * @param[in] path - The path
+     */
+    void append(RecordType type, ChangeLog::Sequence sequence,
+                const std::string& path);
+
+    /**
+     * @brief A helper API to open the journal to append.
+     *
+     * @return True if opened; otherwise False.
+     */
+    bool open();
+
+    /**
+     * @brief The journal file.
+     */
+    fs::path _journalFile;
+
+    /**
+     * @brief The file descriptor of the journal opened to append.
+     */
+    int _fd{-1};
+
+    /**
+     * @brief The encoded records which are not committed yet.
+     */
+    std::string _buffer;
+
+    /**
+     * @brief The number of the records in the last snapshot.
+     */
+    std::size_t _snapshotRecords{0};
+
+    /**
+     * @brief The number of the records appended since the last snapshot.
+     */
+    std::size_t _appendedRecords{0};
+
+    /**
+     * @brief Whether the overflow is journaled since the last snapshot.
+     */
+    bool _overflowLogged{false};
+
+    /**
+     * @brief The fingerprint of the configuration of the last completed full
+     *        sync.
+     */
+    std::optional<std::uint64_t> _fullSyncFingerprint;
+
+    /**
+     * @brief The progress of the full sync which is not completed yet.
+     */
+    std::optional<FullSyncCheckpoint> _fullSyncCheckpoint;
+
+    /**
+     * @brief The fingerprints of the source data when the daemon is stopped
+     *        gracefully last time.
+     */
+    std::optional<std::map<std::string, std::uint64_t, std::less<>>>
+        _shutdownFingerprints;
+};
+
+} // namespace data_sync
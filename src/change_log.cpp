@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "change_log.hpp"
+
+#include <algorithm>
+
+namespace data_sync
+{
+
+namespace
+{
+
+/**
+ * @brief Get the given path without the trailing separators.
+ *
+ * @param[in] path - The path
+ *
+ * @return The trimmed path
+ */
+std::string_view trimSeparators(std::string_view path)
+{
+    while (path.size() > 1 && path.ends_with('/'))
+    {
+        path.remove_suffix(1);
+    }
+    return path;
+}
+
+} // namespace
+
+ChangeLog::Sequence ChangeLog::record(const std::string& path)
+{
+    auto sequence = ++_sequence;
+    log(path, sequence);
+    return sequence;
+}
+
+void ChangeLog::restore(const std::string& path, Sequence sequence)
+{
+    _sequence = std::max(_sequence, sequence);
+    log(path, sequence);
+}
+
+void ChangeLog::log(const std::string& path, Sequence sequence)
+{
+    if (_overflowed)
+    {
+        return;
+    }
+
+    // The change under a changed directory is synced along with it.
+    auto dirChange = findDirChange(path);
+    if (dirChange != _changes.end())
+    {
+        dirChange->second = std::max(dirChange->second, sequence);
+        return;
+    }
+
+    // The changed directory covers the changes which are already logged
+    // under it.
+    if (path.ends_with('/'))
+    {
+        auto change = _changes.lower_bound(path);
+        while (change != _changes.end() && change->first.starts_with(path))
+        {
+            change = _changes.erase(change);
+        }
+    }
+
+    if (!_changes.contains(path) && _changes.size() >= _capacity)
+    {
+        _overflowed = true;
+        return;
+    }
+
+    auto& changeSequence = _changes[path];
+    changeSequence = std::max(changeSequence, sequence);
+}
+
+void ChangeLog::confirm(const std::string& cfgPath, Sequence sequence)
+{
+    auto& highWaterMark = _highWaterMarks[cfgPath];
+    highWaterMark = std::max(highWaterMark, sequence);
+
+    std::vector<std::string> confirmedPaths;
+    forEachChange(cfgPath,
+                  [sequence, &confirmedPaths](const auto& change) {
+        if (change.second <= sequence)
+        {
+            confirmedPaths.push_back(change.first);
+        }
+    });
+    for (const auto& path : confirmedPaths)
+    {
+        _changes.erase(path);
+    }
+}
+
+std::optional<ChangeLog::Sequence>
+    ChangeLog::highWaterMark(const std::string& cfgPath) const
+{
+    auto highWaterMark = _highWaterMarks.find(cfgPath);
+    if (highWaterMark == _highWaterMarks.end())
+    {
+        return std::nullopt;
+    }
+    return highWaterMark->second;
+}
+
+std::vector<std::string>
+    ChangeLog::pendingChanges(const std::string& cfgPath) const
+{
+    std::vector<std::string> changedPaths;
+    forEachChange(cfgPath, [&changedPaths](const auto& change) {
+        changedPaths.push_back(change.first);
+    });
+    return changedPaths;
+}
+
+bool ChangeLog::needsSync(const std::string& cfgPath) const
+{
+    return !_highWaterMarks.contains(cfgPath) || hasPendingChanges(cfgPath);
+}
+
+bool ChangeLog::hasPendingChanges(const std::string& cfgPath) const
+{
+    // The changes are not known once overflowed.
+    if (_overflowed)
+    {
+        return true;
+    }
+
+    bool changed = false;
+    forEachChange(cfgPath, [&changed](const auto&) { changed = true; });
+    return changed;
+}
+
+void ChangeLog::reset()
+{
+    _changes.clear();
+    _overflowed = false;
+}
+
+std::map<std::string, ChangeLog::Sequence, std::less<>>::iterator
+    ChangeLog::findDirChange(std::string_view path)
+{
+    // Look up each parent directory of the path, the changed directories
+    // are logged with the trailing separator.
+    for (auto end = path.find('/'); end != std::string_view::npos &&
+                                    end + 1 < path.size();
+         end = path.find('/', end + 1))
+    {
+        auto dirChange = _changes.find(path.substr(0, end + 1));
+        if (dirChange != _changes.end())
+        {
+            return dirChange;
+        }
+    }
+    return _changes.end();
+}
+
+template <typename Visitor>
+void ChangeLog::forEachChange(std::string_view cfgPath, Visitor visit) const
+{
+    // The paths under the configured path are adjacent in the sorted log.
+    auto prefix = trimSeparators(cfgPath);
+    for (auto change = _changes.lower_bound(prefix);
+         change != _changes.end() && change->first.starts_with(prefix);
+         ++change)
+    {
+        // Skip the siblings which share the prefix, like "/a/file1" of
+        // "/a/file".
+        std::string_view path{change->first};
+        if (path.size() == prefix.size() || prefix.ends_with('/') ||
+            path[prefix.size()] == '/')
+        {
+            visit(*change);
+        }
+    }
+}
+
+} // namespace data_sync
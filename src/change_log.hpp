@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace data_sync
+{
+
+/**
+ * @class ChangeLog
+ *
+ * @brief The class logs the changed paths with a sequence number and tracks
+ *        the sequence up to which each configured path is confirmed synced,
+ *        so that only the data changed since then is synced again after
+ *        a role switch.
+ *
+ *        - A path which is changed again is logged once with its latest
+ *          sequence.
+ *        - A changed directory, that is, a path with the trailing separator,
+ *          covers the changes under it, hence they are logged as the change
+ *          of the directory.
+ *        - The changes are dropped once a sync which covers them is
+ *          confirmed.
+ *        - The log is bounded, once it overflows the changes are not logged
+ *          anymore until it is reset as all the data has to be synced.
+ */
+class ChangeLog
+{
+  public:
+    /**
+     * @brief The sequence number of a change.
+     */
+    using Sequence = std::uint64_t;
+
+    /**
+     * @brief The constructor of the bounded log.
+     *
+     * @param[in] capacity - The maximum number of the changed paths
+     */
+    explicit ChangeLog(
+        std::size_t capacity = std::numeric_limits<std::size_t>::max()) :
+        _capacity(capacity)
+    {}
+
+    /**
+     * @brief Log the change of the given path.
+     *
+     * @param[in] path - The changed path
+     *
+     * @return The sequence number of the change.
+     */
+    Sequence record(const std::string& path);
+
+    /**
+     * @brief Restore the change of the given path with its sequence, like
+     *        from the journal.
+     *
+     * @param[in] path - The changed path
+     * @param[in] sequence - The sequence number of the change
+     */
+    void restore(const std::string& path, Sequence sequence);
+
+    /**
+     * @brief Mark the log as overflowed, like restored from the journal.
+     */
+    void markOverflowed()
+    {
+        _overflowed = true;
+    }
+
+    /**
+     * @brief Confirm the changes of the given configured path up to
+     *        the given sequence are synced.
+     *
+     * @param[in] cfgPath - The configured path
+     * @param[in] sequence - The last sequence covered by the sync
+     */
+    void confirm(const std::string& cfgPath, Sequence sequence);
+
+    /**
+     * @brief Get the sequence up to which the given configured path is
+     *        confirmed synced.
+     *
+     * @param[in] cfgPath - The configured path
+     *
+     * @return The high-water mark if it is ever confirmed; otherwise,
+     *         std::nullopt.
+     */
+    std::optional<Sequence> highWaterMark(const std::string& cfgPath) const;
+
+    /**
+     * @brief Get the changes of the given configured path which are not
+     *        confirmed synced yet.
+     *
+     * @param[in] cfgPath - The configured path, it covers the paths under it
+     *                      if it is a directory
+     *
+     * @return The changed paths
+     */
+    std::vector<std::string> pendingChanges(const std::string& cfgPath) const;
+
+    /**
+     * @brief Check whether the given configured path needs to be synced,
+     *        that is, it has pending changes or it is never confirmed.
+     *
+     * @param[in] cfgPath - The configured path
+     *
+     * @return True if it needs to be synced; otherwise False.
+     */
+    bool needsSync(const std::string& cfgPath) const;
+
+    /**
+     * @brief Check whether the given configured path has the changes which
+     *        are not confirmed synced yet.
+     *
+     * @param[in] cfgPath - The configured path
+     *
+     * @return True if it has the pending changes or the log is overflowed;
+     *         otherwise False.
+     */
+    bool hasPendingChanges(const std::string& cfgPath) const;
+
+    /**
+     * @brief Check whether the log is overflowed, that is, some changes are
+     *        not logged.
+     */
+    bool overflowed() const
+    {
+        return _overflowed;
+    }
+
+    /**
+     * @brief Drop all the pending changes and the overflow once all the data
+     *        is going to be synced.
+     *
+     * @note The high-water marks are kept.
+     */
+    void reset();
+
+    /**
+     * @brief Get the sequence number of the last change.
+     */
+    Sequence sequence() const
+    {
+        return _sequence;
+    }
+
+    /**
+     * @brief Get the latest sequence of each pending changed path.
+     */
+    const std::map<std::string, Sequence, std::less<>>& changes() const
+    {
+        return _changes;
+    }
+
+    /**
+     * @brief Get the confirmed sequence of each configured path.
+     */
+    const std::map<std::string, Sequence, std::less<>>& highWaterMarks() const
+    {
+        return _highWaterMarks;
+    }
+
+    /**
+     * @brief Get the number of the pending changes.
+     */
+    std::size_t size() const
+    {
+        return _changes.size();
+    }
+
+  private:
+    /**
+     * @brief A helper API to visit the logged changes covered by the given
+     *        configured path.
+     *
+     * @param[in] cfgPath - The configured path
+     * @param[in] visit - The visitor of each change
+     */
+    template <typename Visitor>
+    void forEachChange(std::string_view cfgPath, Visitor visit) const;
+
+    /**
+     * @brief A helper API to log the change of the given path.
+     *
+     * @param[in] path - The changed path
+     * @param[in] sequence - The sequence number of the change
+     */
+    void log(const std::string& path, Sequence sequence);
+
+    /**
+     * @brief A helper API to find the logged directory which covers
+     *        the given path.
+     *
+     * @param[in] path - The changed path
+     *
+     * @return The change of the directory if logged; otherwise, the end.
+     */
+    std::map<std::string, Sequence, std::less<>>::iterator
+        findDirChange(std::string_view path);
+
+    /**
+     * @brief The maximum number of the changed paths.
+     */
+    std::size_t _capacity;
+
+    /**
+     * @brief Whether some changes are not logged as the log is full.
+     */
+    bool _overflowed{false};
+
+    /**
+     * @brief The sequence number of the last change.
+     */
+    Sequence _sequence{0};
+
+    /**
+     * @brief The latest sequence of each changed path.
+     */
+    std::map<std::string, Sequence, std::less<>> _changes;
+
+    /**
+     * @brief The confirmed sequence of each configured path.
+     */
+    std::map<std::string, Sequence, std::less<>> _highWaterMarks;
+};
+
+} // namespace data_sync
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "chunk_index.hpp"
+
+#include "fnv1a.hpp"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace data_sync
+{
+
+namespace
+{
+
+/**
+ * @brief The minimum, the average and the maximum size of a chunk, the
+ *        average is a power of two to cut the chunk by the hash mask.
+ */
+constexpr std::size_t minChunkSize = 2 * 1024;
+constexpr std::size_t avgChunkSize = 8 * 1024;
+constexpr std::size_t maxChunkSize = 64 * 1024;
+
+/**
+ * @brief The largest file to index, the larger files are synced by the
+ *        delta of the transfer alone.
+ */
+constexpr std::size_t maxIndexedFileSize = 16 * 1024 * 1024;
+
+/**
+ * @brief The table of the gear rolling hash, random values generated by the
+ *        splitmix64.
+ */
+constexpr auto gearTable = []() {
+    std::array<std::uint64_t, 256> table{};
+    std::uint64_t state = 0;
+    for (auto& value : table)
+    {
+        state += 0x9e3779b97f4a7c15ULL;
+        auto mixed = state;
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+        value = mixed ^ (mixed >> 31);
+    }
+    return table;
+}();
+
+} // namespace
+
+std::vector<ChunkIndex::Digest> ChunkIndex::chunkFile(const std::string& path)
+{
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(path, ec);
+    if (ec || fileSize > maxIndexedFileSize)
+    {
+        return {};
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    std::string content(fileSize, '\0');
+    if (!file.read(content.data(), static_cast<std::streamsize>(fileSize)))
+    {
+        return {};
+    }
+    return chunk(content);
+}
+
+std::optional<ChunkIndex::FileStamp>
+    ChunkIndex::stampFile(const std::string& path)
+{
+    struct stat fileStat{};
+    if (stat(path.c_str(), &fileStat) != 0)
+    {
+        return std::nullopt;
+    }
+    return FileStamp{
+        ._size = static_cast<std::uintmax_t>(fileStat.st_size),
+        ._mtime = (static_cast<std::int64_t>(fileStat.st_mtim.tv_sec) *
+                   1'000'000'000) +
+                  static_cast<std::int64_t>(fileStat.st_mtim.tv_nsec)};
+}
+
+std::vector<ChunkIndex::Digest> ChunkIndex::chunk(std::string_view content)
+{
+    constexpr auto boundaryMask = std::uint64_t{avgChunkSize - 1}
+                                  << (64 - std::countr_zero(avgChunkSize));
+
+    std::vector<Digest> digests;
+    while (!content.empty())
+    {
+        // Cut at the first position whose hash matches the mask after the
+        // minimum size.
+        auto chunkSize = std::min(content.size(), maxChunkSize);
+        std::uint64_t hash = 0;
+        for (auto pos = minChunkSize; pos < chunkSize; ++pos)
+        {
+            hash = (hash << 1) +
+                   gearTable[static_cast<std::uint8_t>(content[pos])];
+            if ((hash & boundaryMask) == 0)
+            {
+                chunkSize = pos + 1;
+                break;
+            }
+        }
+        digests.push_back(fnv1a(content.substr(0, chunkSize)));
+        content.remove_prefix(chunkSize);
+    }
+    return digests;
+}
+
+void ChunkIndex::add(const std::string& destPath, std::vector<Digest> digests,
+                     std::optional<FileStamp> stamp)
+{
+    remove(destPath);
+    for (auto digest : digests)
+    {
+        _chunkFiles[digest].insert(destPath);
+    }
+    _fileChunks.emplace(destPath, std::move(digests));
+    if (stamp.has_value())
+    {
+        _fileStamps.emplace(destPath, *stamp);
+    }
+}
+
+std::optional<std::vector<ChunkIndex::Digest>>
+    ChunkIndex::indexedDigests(const std::string& destPath,
+                               const FileStamp& stamp) const
+{
+    auto fileStamp = _fileStamps.find(destPath);
+    if (fileStamp == _fileStamps.end() || fileStamp->second != stamp)
+    {
+        return std::nullopt;
+    }
+    return _fileChunks.find(destPath)->second;
+}
+
+void ChunkIndex::remove(const std::string& destPath)
+{
+    _fileStamps.erase(destPath);
+    auto fileChunks = _fileChunks.find(destPath);
+    if (fileChunks == _fileChunks.end())
+    {
+        return;
+    }
+
+    for (auto digest : fileChunks->second)
+    {
+        auto chunkFiles = _chunkFiles.find(digest);
+        if (chunkFiles == _chunkFiles.end())
+        {
+            continue;
+        }
+        chunkFiles->second.erase(destPath);
+        if (chunkFiles->second.empty())
+        {
+            _chunkFiles.erase(chunkFiles);
+        }
+    }
+    _fileChunks.erase(fileChunks);
+}
+
+std::optional<std::string>
+    ChunkIndex::findBasis(const std::string& destPath,
+                          const std::vector<Digest>& digests)
+{
+    std::map<std::string_view, std::size_t> sharedChunks;
+    for (auto digest : digests)
+    {
+        ++_stats._lookupChunks;
+        auto chunkFiles = _chunkFiles.find(digest);
+        if (chunkFiles == _chunkFiles.end())
+        {
+            continue;
+        }
+
+        auto hit = false;
+        for (const auto& file : chunkFiles->second)
+        {
+            if (file != destPath)
+            {
+                ++sharedChunks[file];
+                hit = true;
+            }
+        }
+        if (hit)
+        {
+            ++_stats._hitChunks;
+        }
+    }
+
+    auto basis = std::ranges::max_element(
+        sharedChunks, {}, [](const auto& shared) { return shared.second; });
+    if (basis == sharedChunks.end())
+    {
+        return std::nullopt;
+    }
+    ++_stats._basisCount;
+    return std::string(basis->first);
+}
+
+} // namespace data_sync
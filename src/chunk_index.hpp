@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace data_sync
+{
+
+/**
+ * @class ChunkIndex
+ *
+ * @brief The class indexes the content of the synced files by their
+ *        content-defined chunks, to find the synced file which shares the
+ *        most content with a file to sync. The transfer uses it as the basis
+ *        on the receiver so that the shared content is not sent again.
+ *
+ *        - The chunk boundaries are found by a gear rolling hash, hence
+ *          an insertion shifts only the chunks around it.
+ *        - The chunks are identified by their digest, the transfer verifies
+ *          the content against the basis by itself, hence a collision only
+ *          costs the bandwidth.
+ *        - The indexed files are stamped by the size and the modification
+ *          time of their source, like the quick check of the rsync, so that
+ *          the unchanged file is not chunked again.
+ */
+class ChunkIndex
+{
+  public:
+    /**
+     * @brief The digest of a chunk.
+     */
+    using Digest = std::uint64_t;
+
+    /**
+     * @brief The structure contains the size and the modification time of
+     *        a file to detect the change of its content.
+     */
+    struct FileStamp
+    {
+        /**
+         * @brief The size of the file.
+         */
+        std::uintmax_t _size{0};
+
+        /**
+         * @brief The modification time of the file in nanoseconds.
+         */
+        std::int64_t _mtime{0};
+
+        bool operator==(const FileStamp&) const = default;
+    };
+
+    /**
+     * @brief The structure contains the hit rate of the index.
+     */
+    struct Stats
+    {
+        /**
+         * @brief The number of the chunks looked up.
+         */
+        std::uint64_t _lookupChunks{0};
+
+        /**
+         * @brief The number of the chunks found in the other synced files.
+         */
+        std::uint64_t _hitChunks{0};
+
+        /**
+         * @brief The number of the transfers which have a basis.
+         */
+        std::size_t _basisCount{0};
+
+        /**
+         * @brief The bytes matched with the basis instead of being sent.
+         */
+        std::uint64_t _matchedBytes{0};
+    };
+
+    /**
+     * @brief Split the content of the given file into the chunks.
+     *
+     * @param[in] path - The file path
+     *
+     * @return The digests of the chunks in the order of the content, empty
+     *         if failed to read or too large to index.
+     */
+    static std::vector<Digest> chunkFile(const std::string& path);
+
+    /**
+     * @brief Get the stamp of the given file.
+     *
+     * @param[in] path - The file path
+     *
+     * @return The stamp, nullopt if failed to stat the file.
+     */
+    static std::optional<FileStamp> stampFile(const std::string& path);
+
+    /**
+     * @brief Split the given content into the chunks.
+     *
+     * @param[in] content - The content
+     *
+     * @return The digests of the chunks in the order of the content.
+     */
+    static std::vector<Digest> chunk(std::string_view content);
+
+    /**
+     * @brief Index the content of the given synced file, replacing its
+     *        previous content.
+     *
+     * @param[in] destPath - The path of the synced file on the receiver
+     * @param[in] digests - The digests of the chunks of the content
+     * @param[in] stamp - The stamp of the source file when it is chunked,
+     *                    nullopt if not known
+     */
+    void add(const std::string& destPath, std::vector<Digest> digests,
+             std::optional<FileStamp> stamp = std::nullopt);
+
+    /**
+     * @brief Get the indexed digests of the given synced file if its source
+     *        is not changed since it is chunked.
+     *
+     * @param[in] destPath - The path of the synced file on the receiver
+     * @param[in] stamp - The current stamp of the source file
+     *
+     * @return The digests, nullopt if not indexed or changed.
+     */
+    std::optional<std::vector<Digest>>
+        indexedDigests(const std::string& destPath,
+                       const FileStamp& stamp) const;
+
+    /**
+     * @brief Remove the given synced file from the index.
+     *
+     * @param[in] destPath - The path of the synced file on the receiver
+     */
+    void remove(const std::string& destPath);
+
+    /**
+     * @brief Find the other synced file which shares the most chunks with
+     *        the given content.
+     *
+     * @param[in] destPath - The path of the file to sync on the receiver
+     * @param[in] digests - The digests of the chunks of the content
+     *
+     * @return The path of the basis on the receiver, nullopt if none shares
+     *         a chunk.
+     */
+    std::optional<std::string> findBasis(const std::string& destPath,
+                                         const std::vector<Digest>& digests);
+
+    /**
+     * @brief Account the bytes matched with the basis by a transfer.
+     *
+     * @param[in] bytes - The matched bytes
+     */
+    void matched(std::uint64_t bytes)
+    {
+        _stats._matchedBytes += bytes;
+    }
+
+    /**
+     * @brief Get the hit rate of the index.
+     */
+    const Stats& stats() const
+    {
+        return _stats;
+    }
+
+  private:
+    /**
+     * @brief The synced files by the digest of their chunks.
+     */
+    std::map<Digest, std::set<std::string, std::less<>>> _chunkFiles;
+
+    /**
+     * @brief The digests of the chunks by the synced file.
+     */
+    std::map<std::string, std::vector<Digest>, std::less<>> _fileChunks;
+
+    /**
+     * @brief The stamps of the source files when they are chunked, by the
+     *        synced file.
+     */
+    std::map<std::string, FileStamp, std::less<>> _fileStamps;
+
+    /**
+     * @brief The hit rate of the index.
+     */
+    Stats _stats;
+};
+
+} // namespace data_sync
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "compression_policy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+
+namespace data_sync
+{
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+/**
+ * @brief The structure contains the compression levels of an algorithm.
+ */
+struct Levels
+{
+    int _fast;
+    int _default;
+    int _strong;
+};
+
+/**
+ * @brief The compression levels by the algorithm.
+ */
+constexpr std::array<Levels, 2> algorithmLevels{{
+    {._fast = 1, ._default = 6, ._strong = 9}, // zlib
+    {._fast = 1, ._default = 3, ._strong = 19} // zstd
+}};
+
+/**
+ * @brief The size of the file below which the compression doesn't pay off.
+ */
+constexpr std::uintmax_t minCompressSize = 4096;
+
+/**
+ * @brief The measured compression ratio from which it doesn't pay off.
+ */
+constexpr double poorRatio = 0.9;
+
+/**
+ * @brief The number of the uncompressed transfers of the data with the poor
+ *        ratio after which it is compressed to measure again.
+ */
+constexpr std::size_t remeasureInterval = 16;
+
+/**
+ * @brief The extensions of the already compressed files, it is also passed
+ *        to the rsync to skip them inside the directories.
+ */
+constexpr std::array<std::string_view, 23> compressedExtensions{
+    "7z",  "bz2", "cer",  "deb", "der", "gpg", "gz",  "jpeg",
+    "jpg", "lz4", "lzma", "lzo", "p12", "pfx", "png", "rpm",
+    "squashfs", "tbz", "tgz", "ubi", "xz", "zip", "zst"};
+
+/**
+ * @brief The magic numbers of the already compressed file contents.
+ */
+constexpr std::array<std::string_view, 7> compressedMagics{
+    "\x1f\x8b",                 // gzip
+    "\xfd" "7zXZ",              // xz
+    "\x28\xb5\x2f\xfd",         // zstd
+    "BZh",                      // bzip2
+    "PK\x03\x04",               // zip
+    "hsqs",                     // squashfs
+    "\x30\x82"                  // DER encoded certificate
+};
+
+} // namespace
+
+CompressionPolicy::Decision
+    CompressionPolicy::decide(const config::DataSyncConfig& dataSyncCfg)
+{
+    const auto& levels = algorithmLevels[static_cast<std::size_t>(_algorithm)];
+    switch (dataSyncCfg._compression)
+    {
+        case config::Compression::Off:
+            return {};
+        case config::Compression::Fast:
+            return {levels._fast, false, _algorithm};
+        case config::Compression::Strong:
+            return {levels._strong, false, _algorithm};
+        case config::Compression::Auto:
+            break;
+    }
+
+    std::error_code ec;
+    if (fs::is_regular_file(dataSyncCfg._path, ec) &&
+        (fs::file_size(dataSyncCfg._path, ec) < minCompressSize ||
+         isCompressedFile(dataSyncCfg._path)))
+    {
+        return {};
+    }
+
+    auto pathRatio = _pathRatios.find(dataSyncCfg._path);
+    if (pathRatio != _pathRatios.end() && pathRatio->second._ratio >= poorRatio)
+    {
+        // Measure again once in a while as the data may be changed.
+        if (++pathRatio->second._skippedCount < remeasureInterval)
+        {
+            return {};
+        }
+        pathRatio->second._skippedCount = 0;
+    }
+    return {levels._default, true, _algorithm};
+}
+
+void CompressionPolicy::record(const std::string& path, bool compressed,
+                               std::uint64_t literalBytes,
+                               std::uint64_t sentLiteralBytes,
+                               std::chrono::microseconds cpuTime)
+{
+    if (literalBytes == 0)
+    {
+        return;
+    }
+
+    if (!compressed)
+    {
+        ++_stats._uncompressedCount;
+        _uncompressedCost.first += cpuTime;
+        _uncompressedCost.second += literalBytes;
+
+        // Estimate the saving by the CPU cost per byte of the compression
+        // once both are measured.
+        if (_compressedCost.second == 0)
+        {
+            return;
+        }
+        auto costPerByte =
+            (static_cast<double>(_compressedCost.first.count()) /
+             static_cast<double>(_compressedCost.second)) -
+            (static_cast<double>(_uncompressedCost.first.count()) /
+             static_cast<double>(_uncompressedCost.second));
+        if (costPerByte > 0)
+        {
+            _stats._cpuTimeSaved += std::chrono::microseconds(
+                static_cast<std::int64_t>(
+                    costPerByte * static_cast<double>(literalBytes)));
+        }
+        return;
+    }
+
+    ++_stats._compressedCount;
+    _compressedCost.first += cpuTime;
+    _compressedCost.second += literalBytes;
+    if (sentLiteralBytes < literalBytes)
+    {
+        _stats._bytesSaved += literalBytes - sentLiteralBytes;
+    }
+
+    auto ratio = static_cast<double>(sentLiteralBytes) /
+                 static_cast<double>(literalBytes);
+    auto [pathRatio, added] = _pathRatios.try_emplace(path, PathRatio{ratio});
+    if (!added)
+    {
+        // Smooth the ratio over the transfers of the changed parts.
+        pathRatio->second._ratio = (pathRatio->second._ratio + ratio) / 2;
+    }
+}
+
+std::vector<std::string>
+    CompressionPolicy::rsyncArgs(const Decision& decision)
+{
+    if (!decision._level.has_value())
+    {
+        return {};
+    }
+
+    std::vector<std::string> args{
+        "--compress", "--compress-level=" + std::to_string(*decision._level)};
+
+    // The algorithm is chosen explicitly instead of the one negotiated by
+    // the rsync versions of the BMCs, so that the levels match it.
+    args.emplace_back(decision._algorithm == Algorithm::Zstd
+                          ? "--compress-choice=zstd"
+                          : "--compress-choice=zlib");
+    if (decision._skipCompressed)
+    {
+        std::string skipCompress{"--skip-compress="};
+        for (auto extension : compressedExtensions)
+        {
+            skipCompress.append(extension).push_back('/');
+        }
+        skipCompress.pop_back();
+        args.push_back(std::move(skipCompress));
+    }
+    return args;
+}
+
+bool CompressionPolicy::isCompressedFile(const std::string& path)
+{
+    auto extension = fs::path(path).extension().string();
+    if (!extension.empty() &&
+        std::ranges::contains(compressedExtensions,
+                              std::string_view(extension).substr(1)))
+    {
+        return true;
+    }
+
+    std::array<char, 8> header{};
+    std::ifstream file(path, std::ios::binary);
+    file.read(header.data(), header.size());
+    std::string_view content(header.data(),
+                             static_cast<std::size_t>(file.gcount()));
+    return std::ranges::any_of(compressedMagics, [&content](auto magic) {
+        return content.starts_with(magic);
+    });
+}
+
+} // namespace data_sync
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace data_sync
+{
+
+/**
+ * @class CompressionPolicy
+ *
+ * @brief The class decides whether to compress a transfer and how much, so
+ *        that the CPU is not spent on the data which doesn't benefit from
+ *        the compression.
+ *
+ *        - The files which are small or already compressed by their
+ *          extension or content are not compressed.
+ *        - The data whose measured compression ratio is poor is not
+ *          compressed until it is measured again after a number of
+ *          transfers.
+ *        - The configured compression overrides the decision.
+ *        - The rsync can't load a trained zstd dictionary, the similar
+ *          small files benefit from the compression only if they are
+ *          transferred together, as the files of a directory transfer
+ *          share the compression stream.
+ */
+class CompressionPolicy
+{
+  public:
+    /**
+     * @brief The enum contains the compression algorithms of the rsync.
+     */
+    enum class Algorithm : std::uint8_t
+    {
+        Zlib,
+        Zstd
+    };
+
+    /**
+     * @brief The constructor of the policy.
+     *
+     * @param[in] algorithm - The compression algorithm of the transfers
+     */
+    explicit CompressionPolicy(Algorithm algorithm = Algorithm::Zlib) :
+        _algorithm(algorithm)
+    {}
+
+    /**
+     * @brief The structure contains the compression decision of a transfer.
+     */
+    struct Decision
+    {
+        /**
+         * @brief The compression level, nullopt if not compressed.
+         */
+        std::optional<int> _level;
+
+        /**
+         * @brief Whether to skip compressing the already compressed files
+         *        inside the directory.
+         */
+        bool _skipCompressed{false};
+
+        /**
+         * @brief The compression algorithm.
+         */
+        Algorithm _algorithm{Algorithm::Zlib};
+    };
+
+    /**
+     * @brief The structure contains the savings of the compression policy.
+     */
+    struct Stats
+    {
+        /**
+         * @brief The bytes saved on the link by compressing.
+         */
+        std::uint64_t _bytesSaved{0};
+
+        /**
+         * @brief The CPU time estimated to be saved by not compressing.
+         */
+        std::chrono::microseconds _cpuTimeSaved{0};
+
+        /**
+         * @brief The number of the compressed transfers.
+         */
+        std::size_t _compressedCount{0};
+
+        /**
+         * @brief The number of the uncompressed transfers.
+         */
+        std::size_t _uncompressedCount{0};
+    };
+
+    /**
+     * @brief Decide the compression of the transfer of the given data.
+     *
+     * @param[in] dataSyncCfg - The data sync config to transfer
+     *
+     * @return The compression decision.
+     */
+    Decision decide(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief Record the result of a transfer to measure its compression
+     *        ratio and the savings.
+     *
+     * @param[in] path - The configured path of the transfer
+     * @param[in] compressed - Whether the transfer is compressed
+     * @param[in] literalBytes - The bytes of the literal data to transfer
+     * @param[in] sentLiteralBytes - The bytes of the literal data sent on
+     *                               the link, compressed if the transfer is
+     *                               compressed
+     * @param[in] cpuTime - The CPU time taken by the transfer
+     */
+    void record(const std::string& path, bool compressed,
+                std::uint64_t literalBytes, std::uint64_t sentLiteralBytes,
+                std::chrono::microseconds cpuTime);
+
+    /**
+     * @brief Get the savings of the compression policy.
+     */
+    const Stats& stats() const
+    {
+        return _stats;
+    }
+
+    /**
+     * @brief Get the rsync arguments of the given decision.
+     *
+     * @param[in] decision - The compression decision
+     *
+     * @return The rsync arguments.
+     */
+    static std::vector<std::string> rsyncArgs(const Decision& decision);
+
+    /**
+     * @brief Check whether the given file is already compressed by its
+     *        extension or content.
+     *
+     * @param[in] path - The file path
+     *
+     * @return True if compressed; otherwise False.
+     */
+    static bool isCompressedFile(const std::string& path);
+
+  private:
+    /**
+     * @brief The compression algorithm of the transfers.
+     */
+    Algorithm _algorithm;
+
+    /**
+     * @brief The structure contains the measured compression of a path.
+     */
+    struct PathRatio
+    {
+        /**
+         * @brief The ratio of the sent literal bytes to the literal bytes.
+         */
+        double _ratio{1.0};
+
+        /**
+         * @brief The number of the uncompressed transfers since measured.
+         */
+        std::size_t _skippedCount{0};
+    };
+
+    /**
+     * @brief The measured compression by the configured path.
+     */
+    std::map<std::string, PathRatio, std::less<>> _pathRatios;
+
+    /**
+     * @brief The savings of the compression policy.
+     */
+    Stats _stats;
+
+    /**
+     * @brief The CPU time and the data bytes of the compressed transfers,
+     *        to estimate the CPU cost of the compression.
+     */
+    std::pair<std::chrono::microseconds, std::uint64_t> _compressedCost{};
+
+    /**
+     * @brief The CPU time and the data bytes of the uncompressed transfers.
+     */
+    std::pair<std::chrono::microseconds, std::uint64_t> _uncompressedCost{};
+};
+
+} // namespace data_sync
@@ -0,0 +1,493 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config.h"
+
+#include "config_cache.hpp"
+
+#include "fnv1a.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string_view>
+
+namespace data_sync::config
+{
+
+namespace
+{
+
+/**
+ * @brief The cache file format identifier.
+ */
+constexpr std::array<char, 8> cacheMagic{'P', 'D', 'S', 'C', 'F', 'G', 0, 0};
+
+/**
+ * @brief The cache file format version, must be bumped whenever the layout
+ *        of the cache or the members of DataSyncConfig change.
+ */
+constexpr uint32_t cacheVersion = 6;
+
+/**
+ * @brief The header of the cache file.
+ */
+struct CacheHeader
+{
+    std::array<char, 8> _magic;
+    uint32_t _version;
+    uint32_t _defaultRetryInterval;
+    uint64_t _payloadSize;
+    uint64_t _payloadHash;
+};
+
+/**
+ * @class Encoder
+ *
+ * @brief A helper to encode the cache payload.
+ */
+class Encoder
+{
+  public:
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void put(const T& value)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void put(const std::string& str)
+    {
+        put(static_cast<uint32_t>(str.size()));
+        _buffer.append(str);
+    }
+
+    void put(const std::optional<std::vector<std::string>>& list)
+    {
+        put(static_cast<uint8_t>(list.has_value()));
+        if (list.has_value())
+        {
+            put(static_cast<uint32_t>(list->size()));
+            std::ranges::for_each(*list,
+                                  [this](const auto& str) { put(str); });
+        }
+    }
+
+    const std::string& buffer() const
+    {
+        return _buffer;
+    }
+
+  private:
+    std::string _buffer;
+};
+
+/**
+ * @class Decoder
+ *
+ * @brief A helper to decode the cache payload with bounds checking.
+ */
+class Decoder
+{
+  public:
+    explicit Decoder(std::span<const char> data) : _data(data) {}
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool get(T& value)
+    {
+        if (_data.size() - _offset < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&value, _data.subspan(_offset).data(), sizeof(T));
+        _offset += sizeof(T);
+        return true;
+    }
+
+    bool get(std::string& str)
+    {
+        uint32_t size{0};
+        if (!get(size) || _data.size() - _offset < size)
+        {
+            return false;
+        }
+        str.assign(_data.subspan(_offset, size).data(), size);
+        _offset += size;
+        return true;
+    }
+
+    bool get(std::optional<std::vector<std::string>>& list)
+    {
+        uint8_t hasValue{0};
+        if (!get(hasValue))
+        {
+            return false;
+        }
+        if (hasValue == 0)
+        {
+            list = std::nullopt;
+            return true;
+        }
+
+        uint32_t size{0};
+        if (!get(size) || size > _data.size() - _offset)
+        {
+            return false;
+        }
+        list.emplace(size);
+        return std::ranges::all_of(*list,
+                                   [this](auto& str) { return get(str); });
+    }
+
+    bool atEnd() const
+    {
+        return _offset == _data.size();
+    }
+
+  private:
+    std::span<const char> _data;
+    std::size_t _offset{0};
+};
+
+void encode(Encoder& encoder, const SourceFile& sourceFile)
+{
+    encoder.put(sourceFile._path);
+    encoder.put(sourceFile._mtime);
+    encoder.put(sourceFile._size);
+    encoder.put(sourceFile._hash);
+}
+
+bool decode(Decoder& decoder, SourceFile& sourceFile)
+{
+    return decoder.get(sourceFile._path) && decoder.get(sourceFile._mtime) &&
+           decoder.get(sourceFile._size) && decoder.get(sourceFile._hash);
+}
+
+void encode(Encoder& encoder, const DataSyncConfig& dataSyncCfg)
+{
+    encoder.put(dataSyncCfg._path);
+    encoder.put(static_cast<uint8_t>(dataSyncCfg._destPath.has_value()));
+    encoder.put(dataSyncCfg._destPath.value_or(""));
+    encoder.put(dataSyncCfg._syncDirection);
+    encoder.put(dataSyncCfg._syncType);
+    encoder.put(static_cast<uint8_t>(dataSyncCfg._periodicityInSec.has_value()));
+    encoder.put(dataSyncCfg._periodicityInSec.value_or(std::chrono::seconds(0))
+                    .count());
+    encoder.put(static_cast<uint8_t>(dataSyncCfg._retry.has_value()));
+    if (dataSyncCfg._retry.has_value())
+    {
+        encoder.put(dataSyncCfg._retry->_retryAttempts);
+        encoder.put(dataSyncCfg._retry->_retryIntervalInSec.count());
+    }
+    encoder.put(dataSyncCfg._excludeFileList);
+    encoder.put(dataSyncCfg._includeFileList);
+    encoder.put(dataSyncCfg._tier);
+    encoder.put(static_cast<uint8_t>(dataSyncCfg._maxSyncLatency.has_value()));
+    encoder.put(dataSyncCfg._maxSyncLatency
+                    .value_or(std::chrono::milliseconds(0))
+                    .count());
+    encoder.put(dataSyncCfg._bandwidthLimit.value_or(0));
+    encoder.put(dataSyncCfg._compression);
+}
+
+bool decode(Decoder& decoder, DataSyncConfig& dataSyncCfg)
+{
+    uint8_t hasDestPath{0};
+    std::string destPath;
+    uint8_t hasPeriodicity{0};
+    std::chrono::seconds::rep periodicity{0};
+    uint8_t hasRetry{0};
+
+    if (!decoder.get(dataSyncCfg._path) || !decoder.get(hasDestPath) ||
+        !decoder.get(destPath) || !decoder.get(dataSyncCfg._syncDirection) ||
+        !decoder.get(dataSyncCfg._syncType) || !decoder.get(hasPeriodicity) ||
+        !decoder.get(periodicity) || !decoder.get(hasRetry))
+    {
+        return false;
+    }
+
+    if (hasDestPath != 0)
+    {
+        dataSyncCfg._destPath = std::move(destPath);
+    }
+    if (hasPeriodicity != 0)
+    {
+        dataSyncCfg._periodicityInSec = std::chrono::seconds(periodicity);
+    }
+    if (hasRetry != 0)
+    {
+        uint8_t retryAttempts{0};
+        std::chrono::seconds::rep retryInterval{0};
+        if (!decoder.get(retryAttempts) || !decoder.get(retryInterval))
+        {
+            return false;
+        }
+        dataSyncCfg._retry = Retry(retryAttempts,
+                                   std::chrono::seconds(retryInterval));
+    }
+
+    uint8_t hasMaxSyncLatency{0};
+    std::chrono::milliseconds::rep maxSyncLatency{0};
+    uint32_t bandwidthLimit{0};
+    if (!decoder.get(dataSyncCfg._excludeFileList) ||
+        !decoder.get(dataSyncCfg._includeFileList) ||
+        !decoder.get(dataSyncCfg._tier) || !decoder.get(hasMaxSyncLatency) ||
+        !decoder.get(maxSyncLatency) || !decoder.get(bandwidthLimit) ||
+        !decoder.get(dataSyncCfg._compression))
+    {
+        return false;
+    }
+
+    if (hasMaxSyncLatency != 0)
+    {
+        dataSyncCfg._maxSyncLatency = std::chrono::milliseconds(maxSyncLatency);
+    }
+
+    // The bandwidth limit is never zero, hence zero is cached for no limit.
+    if (bandwidthLimit != 0)
+    {
+        dataSyncCfg._bandwidthLimit = bandwidthLimit;
+    }
+    return true;
+}
+
+/**
+ * @class MappedFile
+ *
+ * @brief RAII wrapper to memory-map a file as read only.
+ */
+class MappedFile
+{
+  public:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    explicit MappedFile(const fs::path& path)
+    {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            _size = static_cast<std::size_t>(fileStat.st_size);
+            _addr = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+    }
+
+    ~MappedFile()
+    {
+        if (_addr != MAP_FAILED)
+        {
+            munmap(_addr, _size);
+        }
+    }
+
+    std::span<const char> data() const
+    {
+        if (_addr == MAP_FAILED)
+        {
+            return {};
+        }
+        return {static_cast<const char*>(_addr), _size};
+    }
+
+  private:
+    void* _addr{MAP_FAILED};
+    std::size_t _size{0};
+};
+
+} // namespace
+
+ConfigCache::ConfigCache(const fs::path& cacheFile) : _cacheFile(cacheFile) {}
+
+std::optional<SourceFile> ConfigCache::getSourceFile(const fs::path& cfgFile)
+{
+    struct stat fileStat{};
+    if (stat(cfgFile.c_str(), &fileStat) || !S_ISREG(fileStat.st_mode))
+    {
+        return std::nullopt;
+    }
+
+    SourceFile sourceFile{
+        cfgFile.string(),
+        (static_cast<int64_t>(fileStat.st_mtim.tv_sec) * 1'000'000'000) +
+            fileStat.st_mtim.tv_nsec,
+        static_cast<uint64_t>(fileStat.st_size), 0};
+
+    std::ifstream file(cfgFile, std::ios::binary);
+    std::array<char, 4096> buffer{};
+    uint64_t hash = fnv1a({});
+    while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+    {
+        hash = fnv1a({buffer.data(), static_cast<std::size_t>(file.gcount())},
+                     hash);
+    }
+    sourceFile._hash = hash;
+
+    return sourceFile;
+}
+
+std::vector<SourceFile>
+    ConfigCache::getSourceFiles(const fs::path& dataSyncCfgDir)
+{
+    std::vector<SourceFile> sourceFiles;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(dataSyncCfgDir, ec))
+    {
+        if (auto sourceFile = getSourceFile(entry.path());
+            sourceFile.has_value())
+        {
+            sourceFiles.emplace_back(std::move(*sourceFile));
+        }
+    }
+
+    std::ranges::sort(sourceFiles, {}, &SourceFile::_path);
+    return sourceFiles;
+}
+
+std::optional<std::vector<std::vector<DataSyncConfig>>>
+    ConfigCache::load(const std::vector<SourceFile>& sourceFiles) const
+{
+    MappedFile cache{_cacheFile};
+    auto data = cache.data();
+    if (data.size() < sizeof(CacheHeader))
+    {
+        return std::nullopt;
+    }
+
+    CacheHeader header{};
+    std::memcpy(&header, data.data(), sizeof(CacheHeader));
+    auto payload = data.subspan(sizeof(CacheHeader));
+
+    if (header._magic != cacheMagic || header._version != cacheVersion ||
+        header._defaultRetryInterval != DEFAULT_RETRY_INTERVAL ||
+        header._payloadSize != payload.size() ||
+        header._payloadHash != fnv1a({payload.data(), payload.size()}))
+    {
+        lg2::info("Ignoring the outdated or corrupted config cache {CACHE}",
+                  "CACHE", _cacheFile);
+        return std::nullopt;
+    }
+
+    Decoder decoder{payload};
+
+    uint32_t sourceCount{0};
+    if (!decoder.get(sourceCount) || sourceCount != sourceFiles.size())
+    {
+        return std::nullopt;
+    }
+    for (const auto& sourceFile : sourceFiles)
+    {
+        SourceFile cachedSourceFile;
+        if (!decode(decoder, cachedSourceFile) ||
+            cachedSourceFile != sourceFile)
+        {
+            lg2::info("The config cache is outdated as {CONFIG_FILE} "
+                      "is changed",
+                      "CONFIG_FILE", sourceFile._path);
+            return std::nullopt;
+        }
+    }
+
+    std::vector<std::vector<DataSyncConfig>> dataSyncCfgs(sourceFiles.size());
+    for (auto& fileCfgs : dataSyncCfgs)
+    {
+        uint32_t cfgCount{0};
+        if (!decoder.get(cfgCount) || cfgCount > payload.size())
+        {
+            return std::nullopt;
+        }
+
+        fileCfgs.resize(cfgCount);
+        if (!std::ranges::all_of(fileCfgs, [&decoder](auto& dataSyncCfg) {
+            return decode(decoder, dataSyncCfg);
+        }))
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (!decoder.atEnd())
+    {
+        return std::nullopt;
+    }
+
+    return dataSyncCfgs;
+}
+
+bool ConfigCache::store(
+    const std::vector<SourceFile>& sourceFiles,
+    const std::vector<std::vector<DataSyncConfig>>& dataSyncCfgs) const
+{
+    if (sourceFiles.size() != dataSyncCfgs.size())
+    {
+        return false;
+    }
+
+    Encoder encoder;
+    encoder.put(static_cast<uint32_t>(sourceFiles.size()));
+    std::ranges::for_each(sourceFiles, [&encoder](const auto& sourceFile) {
+        encode(encoder, sourceFile);
+    });
+    std::ranges::for_each(dataSyncCfgs, [&encoder](const auto& fileCfgs) {
+        encoder.put(static_cast<uint32_t>(fileCfgs.size()));
+        std::ranges::for_each(fileCfgs, [&encoder](const auto& dataSyncCfg) {
+            encode(encoder, dataSyncCfg);
+        });
+    });
+
+    const auto& payload = encoder.buffer();
+    CacheHeader header{cacheMagic, cacheVersion, DEFAULT_RETRY_INTERVAL,
+                       payload.size(), fnv1a(payload)};
+
+    std::error_code ec;
+    fs::create_directories(_cacheFile.parent_path(), ec);
+
+    // Write into a temporary file and rename it to replace the cache
+    // atomically.
+    auto tmpCacheFile = _cacheFile;
+    tmpCacheFile += ".tmp";
+    {
+        std::ofstream file(tmpCacheFile, std::ios::binary | std::ios::trunc);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        if (!file.flush())
+        {
+            lg2::error("Failed to write the config cache {CACHE}", "CACHE",
+                       tmpCacheFile);
+            fs::remove(tmpCacheFile, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tmpCacheFile, _cacheFile, ec);
+    if (ec)
+    {
+        lg2::error("Failed to store the config cache {CACHE}, error: {ERROR}",
+                   "CACHE", _cacheFile, "ERROR", ec.message());
+        fs::remove(tmpCacheFile, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace data_sync::config
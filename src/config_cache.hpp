@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace data_sync::config
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The structure contains the details of a configuration file which
+ *        are used to validate the config cache.
+ */
+struct SourceFile
+{
+    /**
+     * @brief Overload the == operator to compare objects.
+     *
+     * @param[in] sourceFile - The object to check
+     *
+     * @return True if it matches; otherwise, False.
+     */
+    bool operator==(const SourceFile& sourceFile) const = default;
+
+    /**
+     * @brief The configuration file path.
+     */
+    std::string _path;
+
+    /**
+     * @brief The last modification time in nanoseconds since epoch.
+     */
+    int64_t _mtime{0};
+
+    /**
+     * @brief The file size in bytes.
+     */
+    uint64_t _size{0};
+
+    /**
+     * @brief The FNV-1a hash of the file content.
+     */
+    uint64_t _hash{0};
+};
+
+/**
+ * @class ConfigCache
+ *
+ * @brief The class maintains a compact binary cache of the parsed data sync
+ *        configurations to avoid parsing the JSON configuration files on
+ *        every start.
+ *
+ *        - The cache records the details of the configuration files it is
+ *          built from and it is used only if all of them still match.
+ *        - The cache is memory-mapped and decoded without any JSON parsing.
+ *        - The cache is replaced atomically when it is stored.
+ */
+class ConfigCache
+{
+  public:
+    /**
+     * @brief The constructor
+     *
+     * @param[in] cacheFile - The path of the cache file
+     */
+    explicit ConfigCache(const fs::path& cacheFile);
+
+    /**
+     * @brief Get the details of the given configuration file.
+     *
+     * @param[in] cfgFile - The configuration file
+     *
+     * @return The details if it is a regular file; otherwise, nullopt.
+     */
+    static std::optional<SourceFile> getSourceFile(const fs::path& cfgFile);
+
+    /**
+     * @brief Get the details of the configuration files in the given
+     *        directory, sorted by the path.
+     *
+     * @param[in] dataSyncCfgDir - The data sync configuration directory
+     *
+     * @return The configuration files.
+     */
+    static std::vector<SourceFile> getSourceFiles(const fs::path& dataSyncCfgDir);
+
+    /**
+     * @brief Load the cached configurations.
+     *
+     * @param[in] sourceFiles - The current configuration files
+     *
+     * @return The configurations of the configuration file at the same
+     *         index if the cache is intact and built from the given
+     *         configuration files; otherwise, nullopt.
+     */
+    std::optional<std::vector<std::vector<DataSyncConfig>>>
+        load(const std::vector<SourceFile>& sourceFiles) const;
+
+    /**
+     * @brief Store the given configurations in the cache.
+     *
+     * @param[in] sourceFiles - The configuration files which the
+     *                          configurations are parsed from
+     * @param[in] dataSyncCfgs - The parsed configurations of the
+     *                           configuration file at the same index
+     *
+     * @return True if stored; otherwise False.
+     */
+    bool store(const std::vector<SourceFile>& sourceFiles,
+               const std::vector<std::vector<DataSyncConfig>>& dataSyncCfgs)
+        const;
+
+  private:
+    /**
+     * @brief The path of the cache file.
+     */
+    fs::path _cacheFile;
+};
+
+} // namespace data_sync::config
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_loader.hpp"
+
+#include "worker.hpp"
+
+#include <nlohmann/json.hpp>
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iterator>
+
+namespace data_sync::config
+{
+
+ConfigLoader::ConfigLoader(sdbusplus::async::context& ctx,
+                           std::vector<std::string> configFiles,
+                           std::size_t workerCount) :
+    _ctx(ctx), _configFiles(std::move(configFiles)),
+    _parsedFiles(_configFiles.size()),
+    _workerCount(workerCount != 0
+                     ? workerCount
+                     : std::max(std::thread::hardware_concurrency(), 1U))
+{}
+
+bool ConfigLoader::parseFile(const std::string& configFile,
+                             std::vector<DataSyncConfig>& dataSyncCfgs)
+{
+    try
+    {
+        std::ifstream file;
+        file.open(configFile);
+
+        nlohmann::json configJSON(nlohmann::json::parse(file));
+
+        for (const auto* key : {"Files", "Directories"})
+        {
+            if (!configJSON.contains(key))
+            {
+                continue;
+            }
+            const auto& dataList = configJSON[key];
+            dataSyncCfgs.reserve(dataSyncCfgs.size() + dataList.size());
+            std::ranges::transform(dataList, std::back_inserter(dataSyncCfgs),
+                                   [](const auto& element) {
+                return DataSyncConfig(element);
+            });
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // TODO Create error log
+        lg2::error("Failed to parse the configuration file : {CONFIG_FILE},"
+                   " exception : {EXCEPTION}",
+                   "CONFIG_FILE", configFile, "EXCEPTION", e);
+        dataSyncCfgs.clear();
+        return false;
+    }
+    return true;
+}
+
+void ConfigLoader::parseFiles()
+{
+    for (auto index = _nextFile++; index < _configFiles.size();
+         index = _nextFile++)
+    {
+        auto& parsedFile = _parsedFiles[index];
+
+        auto parseStartTime = std::chrono::steady_clock::now();
+        parsedFile._parsed = parseFile(_configFiles[index],
+                                       parsedFile._dataSyncCfgs);
+        parsedFile._parseTime =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - parseStartTime);
+    }
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<ParsedCfgFiles> ConfigLoader::load()
+{
+    // The worker which notifies the event loop parses the files together
+    // with the other workers and waits for them.
+    auto workerCount = std::min(_workerCount, _configFiles.size());
+    auto parsedFiles = co_await runInWorker(_ctx, [this, workerCount]() {
+        {
+            std::vector<std::jthread> workers;
+            for (std::size_t worker = 1; worker < workerCount; ++worker)
+            {
+                workers.emplace_back(&ConfigLoader::parseFiles, this);
+            }
+            parseFiles();
+        }
+        return std::move(_parsedFiles);
+    });
+
+    ParsedCfgFiles parsedCfgs;
+    parsedCfgs.reserve(_configFiles.size());
+    for (std::size_t index = 0; index < _configFiles.size(); ++index)
+    {
+        auto& parsedFile = parsedFiles[index];
+        lg2::info("Parsed {COUNT} configurations from {CONFIG_FILE} in "
+                  "{DURATION_US} us",
+                  "COUNT", parsedFile._dataSyncCfgs.size(), "CONFIG_FILE",
+                  _configFiles[index], "DURATION_US",
+                  parsedFile._parseTime.count());
+
+        if (parsedFile._parsed)
+        {
+            parsedCfgs.emplace_back(std::move(parsedFile._dataSyncCfgs));
+        }
+        else
+        {
+            parsedCfgs.emplace_back(std::nullopt);
+        }
+    }
+
+    co_return parsedCfgs;
+}
+
+} // namespace data_sync::config
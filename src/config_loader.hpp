@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace data_sync::config
+{
+
+/**
+ * @brief The parsed configurations of each configuration file, nullopt if
+ *        the file fails to parse.
+ */
+using ParsedCfgFiles = std::vector<std::optional<std::vector<DataSyncConfig>>>;
+
+/**
+ * @class ConfigLoader
+ *
+ * @brief The class parses the data sync configuration files concurrently on
+ *        the worker threads without blocking the event loop.
+ *
+ *        - Each file is parsed into its own result so that a file which
+ *          fails to parse doesn't affect the others.
+ *        - The results are returned in the given order of the files so that
+ *          the loaded configurations don't depend on the thread scheduling.
+ */
+class ConfigLoader
+{
+  public:
+    ConfigLoader(const ConfigLoader&) = delete;
+    ConfigLoader& operator=(const ConfigLoader&) = delete;
+    ConfigLoader(ConfigLoader&&) = delete;
+    ConfigLoader& operator=(ConfigLoader&&) = delete;
+
+    /**
+     * @brief The constructor
+     *
+     * @param[in] ctx - The async context
+     * @param[in] configFiles - The configuration files to parse
+     * @param[in] workerCount - The maximum number of worker threads, the
+     *                          number of CPUs is used if zero
+     */
+    ConfigLoader(sdbusplus::async::context& ctx,
+                 std::vector<std::string> configFiles,
+                 std::size_t workerCount = 0);
+
+    ~ConfigLoader() = default;
+
+    /**
+     * @brief Parse the configuration files.
+     *
+     * @return The parsed configurations of the configuration file at the
+     *         same index, nullopt if the file fails to parse.
+     *
+     * @note The files are parsed only once per instance.
+     */
+    sdbusplus::async::task<ParsedCfgFiles> load();
+
+    /**
+     * @brief Parse the given configuration file.
+     *
+     * @param[in] configFile - The configuration file to parse
+     * @param[out] dataSyncCfgs - The parsed configurations
+     *
+     * @return True if parsed; otherwise False.
+     */
+    static bool parseFile(const std::string& configFile,
+                          std::vector<DataSyncConfig>& dataSyncCfgs);
+
+  private:
+    /**
+     * @brief The structure contains the parsed result of a configuration
+     *        file.
+     */
+    struct ParsedFile
+    {
+        /**
+         * @brief The parsed configurations.
+         */
+        std::vector<DataSyncConfig> _dataSyncCfgs;
+
+        /**
+         * @brief Whether the file is parsed.
+         */
+        bool _parsed{false};
+
+        /**
+         * @brief The time taken to parse the file.
+         */
+        std::chrono::microseconds _parseTime{0};
+    };
+
+    /**
+     * @brief The worker thread which parses the files until none is left.
+     */
+    void parseFiles();
+
+    /**
+     * @brief The async context.
+     */
+    sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief The configuration files to parse.
+     */
+    std::vector<std::string> _configFiles;
+
+    /**
+     * @brief The parsed result of the configuration file at the same index.
+     */
+    std::vector<ParsedFile> _parsedFiles;
+
+    /**
+     * @brief The index of the next configuration file to parse.
+     */
+    std::atomic<std::size_t> _nextFile{0};
+
+    /**
+     * @brief The maximum number of worker threads.
+     */
+    std::size_t _workerCount;
+};
+
+} // namespace data_sync::config
@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_planner.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+namespace data_sync::config
+{
+
+namespace
+{
+
+/**
+ * @brief A helper API to normalize the given path to compare it
+ *        component-wise.
+ */
+fs::path normalize(const fs::path& path)
+{
+    auto normalPath = path.lexically_normal();
+    if (!normalPath.has_filename() && normalPath.has_parent_path() &&
+        normalPath != normalPath.root_path())
+    {
+        normalPath = normalPath.parent_path();
+    }
+    return normalPath;
+}
+
+/**
+ * @brief A helper API to check whether the given path is the same as or
+ *        inside the given directory.
+ */
+bool isWithin(const fs::path& path, const fs::path& dir)
+{
+    auto normalPath = normalize(path);
+    auto normalDir = normalize(dir);
+    auto [pathIt, dirIt] = std::ranges::mismatch(normalPath, normalDir);
+    return dirIt == normalDir.end();
+}
+
+/**
+ * @brief A helper API to check whether the given configurations sync in
+ *        the same direction and type.
+ */
+bool isSameSync(const DataSyncConfig& lhs, const DataSyncConfig& rhs)
+{
+    return lhs._syncDirection == rhs._syncDirection &&
+           lhs._syncType == rhs._syncType;
+}
+
+/**
+ * @brief A helper API to warn about the overlapping configurations which are
+ *        synced in the conflicting way.
+ */
+void warnIfConflicting(const DataSyncConfig& dataSyncCfg,
+                       const DataSyncConfig& overlappingCfg)
+{
+    if (dataSyncCfg._syncDirection != overlappingCfg._syncDirection)
+    {
+        lg2::warning("The path [{PATH}] with the sync direction {DIRECTION} "
+                     "overlaps the path [{OVERLAPPING_PATH}] with the sync "
+                     "direction {OVERLAPPING_DIRECTION}",
+                     "PATH", dataSyncCfg._path, "DIRECTION",
+                     dataSyncCfg.getSyncDirectionInStr(), "OVERLAPPING_PATH",
+                     overlappingCfg._path, "OVERLAPPING_DIRECTION",
+                     overlappingCfg.getSyncDirectionInStr());
+    }
+    else if (dataSyncCfg._syncType != overlappingCfg._syncType)
+    {
+        lg2::warning("The path [{PATH}] with the sync type {TYPE} overlaps "
+                     "the path [{OVERLAPPING_PATH}] with the sync type "
+                     "{OVERLAPPING_TYPE}",
+                     "PATH", dataSyncCfg._path, "TYPE",
+                     dataSyncCfg.getSyncTypeInStr(), "OVERLAPPING_PATH",
+                     overlappingCfg._path, "OVERLAPPING_TYPE",
+                     overlappingCfg.getSyncTypeInStr());
+    }
+}
+
+/**
+ * @brief A helper API to check whether the given directory configuration
+ *        syncs all the data of the given nested configuration.
+ */
+bool covers(const DataSyncConfig& dirCfg, const DataSyncConfig& nestedCfg)
+{
+    if (!isSameSync(dirCfg, nestedCfg))
+    {
+        return false;
+    }
+
+    // The nested data must not need to be synced more often than the
+    // directory.
+    if (dirCfg._syncType == SyncType::Periodic &&
+        nestedCfg._periodicityInSec < dirCfg._periodicityInSec)
+    {
+        return false;
+    }
+
+    // The nested data must be compressed as configured.
+    if (nestedCfg._compression != Compression::Auto &&
+        nestedCfg._compression != dirCfg._compression)
+    {
+        return false;
+    }
+
+    // The nested data must not need to be synced sooner than the directory
+    // once changed.
+    if (nestedCfg._maxSyncLatency.has_value() &&
+        (!dirCfg._maxSyncLatency.has_value() ||
+         *nestedCfg._maxSyncLatency < *dirCfg._maxSyncLatency))
+    {
+        return false;
+    }
+
+    // The nested data must not be synced later than the directory by the
+    // full sync.
+    if (nestedCfg._tier < dirCfg._tier)
+    {
+        return false;
+    }
+
+    // The nested data must end up in the same destination.
+    auto relativePath = normalize(nestedCfg._path)
+                            .lexically_relative(normalize(dirCfg._path));
+    auto expectedDest = fs::path(dirCfg._destPath.value_or(dirCfg._path)) /
+                        relativePath;
+    if (normalize(expectedDest) !=
+        normalize(nestedCfg._destPath.value_or(nestedCfg._path)))
+    {
+        return false;
+    }
+
+    if (dirCfg._includeFileList.has_value() &&
+        std::ranges::none_of(*dirCfg._includeFileList,
+                             [&nestedCfg](const auto& includePath) {
+        return isWithin(nestedCfg._path, includePath);
+    }))
+    {
+        return false;
+    }
+
+    return !dirCfg._excludeFileList.has_value() ||
+           std::ranges::none_of(*dirCfg._excludeFileList,
+                                [&nestedCfg](const auto& excludePath) {
+        return isWithin(nestedCfg._path, excludePath) ||
+               isWithin(excludePath, nestedCfg._path);
+    });
+}
+
+} // namespace
+
+ConfigPlanner::ConfigPlanner(std::vector<DataSyncConfig> dataSyncCfgs) :
+    _dataSyncCfgs(std::move(dataSyncCfgs)), _keep(_dataSyncCfgs.size(), true)
+{
+    for (std::size_t index = 0; index < _dataSyncCfgs.size(); ++index)
+    {
+        Node* node = &_root;
+        for (const auto& component : normalize(_dataSyncCfgs[index]._path))
+        {
+            auto& child = node->_children[component.string()];
+            if (!child)
+            {
+                child = std::make_unique<Node>();
+            }
+            node = child.get();
+        }
+        node->_cfgIndices.emplace_back(index);
+    }
+}
+
+void ConfigPlanner::mergeDuplicates(Node& node)
+{
+    for (auto it = node._cfgIndices.begin(); it != node._cfgIndices.end(); ++it)
+    {
+        if (!_keep[*it])
+        {
+            continue;
+        }
+
+        auto& dataSyncCfg = _dataSyncCfgs[*it];
+        for (auto dupIndex : std::ranges::subrange(std::next(it),
+                                                   node._cfgIndices.end()))
+        {
+            auto& duplicateCfg = _dataSyncCfgs[dupIndex];
+            if (!_keep[dupIndex] ||
+                normalize(dataSyncCfg._destPath.value_or(dataSyncCfg._path)) !=
+                    normalize(
+                        duplicateCfg._destPath.value_or(duplicateCfg._path)))
+            {
+                continue;
+            }
+
+            if (!isSameSync(dataSyncCfg, duplicateCfg))
+            {
+                warnIfConflicting(dataSyncCfg, duplicateCfg);
+                continue;
+            }
+
+            // Merge to sync the union of the data as often as required by
+            // any of the duplicates.
+            dataSyncCfg._periodicityInSec = std::min(
+                dataSyncCfg._periodicityInSec, duplicateCfg._periodicityInSec);
+            if (!dataSyncCfg._retry.has_value())
+            {
+                dataSyncCfg._retry = duplicateCfg._retry;
+            }
+            dataSyncCfg._tier = std::min(dataSyncCfg._tier, duplicateCfg._tier);
+            if (!dataSyncCfg._maxSyncLatency.has_value() ||
+                (duplicateCfg._maxSyncLatency.has_value() &&
+                 *duplicateCfg._maxSyncLatency < *dataSyncCfg._maxSyncLatency))
+            {
+                dataSyncCfg._maxSyncLatency = duplicateCfg._maxSyncLatency;
+            }
+
+            // Keep the strictest bandwidth limit of the duplicates to not
+            // load the link more than any of them allows.
+            if (!dataSyncCfg._bandwidthLimit.has_value() ||
+                (duplicateCfg._bandwidthLimit.has_value() &&
+                 *duplicateCfg._bandwidthLimit < *dataSyncCfg._bandwidthLimit))
+            {
+                dataSyncCfg._bandwidthLimit = duplicateCfg._bandwidthLimit;
+            }
+            dataSyncCfg._compression = std::max(dataSyncCfg._compression,
+                                                duplicateCfg._compression);
+
+            if (!duplicateCfg._includeFileList.has_value())
+            {
+                dataSyncCfg._includeFileList = std::nullopt;
+            }
+            else if (dataSyncCfg._includeFileList.has_value())
+            {
+                auto& includeList = *dataSyncCfg._includeFileList;
+                std::ranges::copy_if(*duplicateCfg._includeFileList,
+                                     std::back_inserter(includeList),
+                                     [&includeList](const auto& path) {
+                    return !std::ranges::contains(includeList, path);
+                });
+            }
+
+            if (!duplicateCfg._excludeFileList.has_value())
+            {
+                dataSyncCfg._excludeFileList = std::nullopt;
+            }
+            else if (dataSyncCfg._excludeFileList.has_value())
+            {
+                std::erase_if(*dataSyncCfg._excludeFileList,
+                              [&duplicateCfg](const auto& path) {
+                    return !std::ranges::contains(
+                        *duplicateCfg._excludeFileList, path);
+                });
+                if (dataSyncCfg._excludeFileList->empty())
+                {
+                    dataSyncCfg._excludeFileList = std::nullopt;
+                }
+            }
+
+            _keep[dupIndex] = false;
+            lg2::info("Merged the duplicate configuration of the path [{PATH}]",
+                      "PATH", duplicateCfg._path);
+        }
+    }
+}
+
+bool ConfigPlanner::isCoveredByAncestor(
+    std::size_t cfgIndex, const std::vector<const Node*>& ancestors) const
+{
+    const auto& nestedCfg = _dataSyncCfgs[cfgIndex];
+
+    for (const auto* ancestor : ancestors | std::views::reverse)
+    {
+        for (auto dirIndex : ancestor->_cfgIndices)
+        {
+            // The duplicate merged into another one doesn't sync the data
+            // as configured anymore.
+            if (!_keep[dirIndex])
+            {
+                continue;
+            }
+
+            const auto& dirCfg = _dataSyncCfgs[dirIndex];
+            if (covers(dirCfg, nestedCfg))
+            {
+                lg2::info("The path [{PATH}] is already synced as part of the "
+                          "directory [{DIRECTORY}]",
+                          "PATH", nestedCfg._path, "DIRECTORY", dirCfg._path);
+                return true;
+            }
+            warnIfConflicting(nestedCfg, dirCfg);
+        }
+    }
+    return false;
+}
+
+void ConfigPlanner::visit(Node& node, std::vector<const Node*>& ancestors)
+{
+    if (!node._cfgIndices.empty())
+    {
+        mergeDuplicates(node);
+
+        for (auto cfgIndex : node._cfgIndices)
+        {
+            if (_keep[cfgIndex] && isCoveredByAncestor(cfgIndex, ancestors))
+            {
+                _keep[cfgIndex] = false;
+            }
+        }
+        ancestors.emplace_back(&node);
+    }
+
+    for (auto& [component, child] : node._children)
+    {
+        visit(*child, ancestors);
+    }
+
+    if (!node._cfgIndices.empty())
+    {
+        ancestors.pop_back();
+    }
+}
+
+std::vector<DataSyncConfig> ConfigPlanner::plan()
+{
+    std::vector<const Node*> ancestors;
+    visit(_root, ancestors);
+
+    std::vector<DataSyncConfig> plannedCfgs;
+    plannedCfgs.reserve(std::ranges::count(_keep, true));
+    for (std::size_t index = 0; index < _dataSyncCfgs.size(); ++index)
+    {
+        if (_keep[index])
+        {
+            plannedCfgs.emplace_back(std::move(_dataSyncCfgs[index]));
+        }
+    }
+    return plannedCfgs;
+}
+
+} // namespace data_sync::config
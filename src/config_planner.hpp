@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace data_sync::config
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class ConfigPlanner
+ *
+ * @brief The class plans the minimal, non overlapping set of data sync
+ *        configurations from the parsed configurations of all the
+ *        configuration files.
+ *
+ *        - The configurations are arranged in a path trie by the path
+ *          components to detect the duplicate paths and the paths which are
+ *          inside an already configured directory.
+ *        - The duplicate paths are merged if they are synced in the same way.
+ *        - The paths inside a configured directory are dropped if the
+ *          directory sync already covers them.
+ *        - The overlapping paths with the conflicting sync direction or sync
+ *          type are kept as is with a warning.
+ */
+class ConfigPlanner
+{
+  public:
+    /**
+     * @brief The constructor builds the path trie of the given configurations.
+     *
+     * @param[in] dataSyncCfgs - The parsed data sync configurations
+     */
+    explicit ConfigPlanner(std::vector<DataSyncConfig> dataSyncCfgs);
+
+    /**
+     * @brief Plan the non overlapping data sync configurations.
+     *
+     * @return The planned configurations in the parsed order.
+     */
+    std::vector<DataSyncConfig> plan();
+
+  private:
+    /**
+     * @brief The structure represents a path component in the path trie.
+     */
+    struct Node
+    {
+        /**
+         * @brief The child path components.
+         */
+        std::map<std::string, std::unique_ptr<Node>> _children;
+
+        /**
+         * @brief The indices of the configurations of this path.
+         */
+        std::vector<std::size_t> _cfgIndices;
+    };
+
+    /**
+     * @brief A helper API to merge the duplicate configurations of the given
+     *        node into the first compatible configuration.
+     *
+     * @param[in] node - The node which has the duplicate configurations
+     */
+    void mergeDuplicates(Node& node);
+
+    /**
+     * @brief A helper API to check whether the given configuration is covered
+     *        by the configurations of its ancestor directories.
+     *
+     * @param[in] cfgIndex - The index of the configuration to check
+     * @param[in] ancestors - The ancestor nodes, nearest one last
+     *
+     * @return True if covered; otherwise False.
+     */
+    bool isCoveredByAncestor(std::size_t cfgIndex,
+                             const std::vector<const Node*>& ancestors) const;
+
+    /**
+     * @brief A helper API to visit the path trie to plan the configurations.
+     *
+     * @param[in] node - The node to visit
+     * @param[in,out] ancestors - The ancestor nodes which have configurations
+     */
+    void visit(Node& node, std::vector<const Node*>& ancestors);
+
+    /**
+     * @brief The parsed data sync configurations.
+     */
+    std::vector<DataSyncConfig> _dataSyncCfgs;
+
+    /**
+     * @brief Whether the configuration at the same index is kept in the plan.
+     */
+    std::vector<bool> _keep;
+
+    /**
+     * @brief The root of the path trie.
+     */
+    Node _root;
+};
+
+} // namespace data_sync::config
@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_store.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace data_sync::config
+{
+
+ConfigStore::ConfigStore(const std::vector<DataSyncConfig>& dataSyncCfgs)
+{
+    _cfgs.reserve(dataSyncCfgs.size());
+    for (const auto& dataSyncCfg : dataSyncCfgs)
+    {
+        add(dataSyncCfg);
+    }
+
+    // The store is mostly built at once, hence release the capacity reserved
+    // for the growth.
+    _pathPool.shrinkToFit();
+    _listPaths.shrink_to_fit();
+    _pathHeads.shrink_to_fit();
+    _destPathHeads.shrink_to_fit();
+    for (auto& syncModeCfgs : _syncModeIndex)
+    {
+        syncModeCfgs.shrink_to_fit();
+    }
+}
+
+std::size_t ConfigStore::add(const DataSyncConfig& dataSyncCfg)
+{
+    CompactConfig cfg;
+    cfg._path = _pathPool.intern(dataSyncCfg._path);
+    if (dataSyncCfg._destPath.has_value())
+    {
+        cfg._destPath = _pathPool.intern(*dataSyncCfg._destPath);
+    }
+
+    cfg._flags = static_cast<std::uint8_t>(dataSyncCfg._syncDirection) &
+                 syncDirectionMask;
+    cfg._tier = dataSyncCfg._tier;
+    cfg._compression = dataSyncCfg._compression;
+    if (dataSyncCfg._syncType == SyncType::Periodic)
+    {
+        cfg._flags |= periodicSyncType;
+    }
+
+    if (dataSyncCfg._periodicityInSec.has_value())
+    {
+        cfg._flags |= hasPeriodicity;
+        cfg._periodicityInSec = dataSyncCfg._periodicityInSec->count();
+    }
+
+    if (dataSyncCfg._retry.has_value())
+    {
+        cfg._flags |= hasRetry;
+        cfg._retryAttempts = dataSyncCfg._retry->_retryAttempts;
+        cfg._retryIntervalInSec =
+            dataSyncCfg._retry->_retryIntervalInSec.count();
+    }
+
+    if (dataSyncCfg._maxSyncLatency.has_value())
+    {
+        cfg._flags |= hasMaxSyncLatency;
+        cfg._maxSyncLatencyInMs = dataSyncCfg._maxSyncLatency->count();
+    }
+    cfg._bandwidthLimit = dataSyncCfg._bandwidthLimit.value_or(0);
+
+    cfg._listOffset = static_cast<std::uint32_t>(_listPaths.size());
+    if (dataSyncCfg._excludeFileList.has_value())
+    {
+        cfg._flags |= hasExcludeList;
+        cfg._excludeCount =
+            static_cast<std::uint32_t>(dataSyncCfg._excludeFileList->size());
+        for (const auto& path : *dataSyncCfg._excludeFileList)
+        {
+            _listPaths.push_back(_pathPool.intern(path));
+        }
+    }
+    if (dataSyncCfg._includeFileList.has_value())
+    {
+        cfg._flags |= hasIncludeList;
+        cfg._includeCount =
+            static_cast<std::uint32_t>(dataSyncCfg._includeFileList->size());
+        for (const auto& path : *dataSyncCfg._includeFileList)
+        {
+            _listPaths.push_back(_pathPool.intern(path));
+        }
+    }
+
+    _cfgs.push_back(cfg);
+    indexCfg(_cfgs.size() - 1);
+    return _cfgs.size() - 1;
+}
+
+bool ConfigStore::remove(const DataSyncConfig& dataSyncCfg)
+{
+    auto indices = findByPath(dataSyncCfg._path);
+    auto index = std::ranges::find_if(indices, [&](auto index) {
+        return matches(index, dataSyncCfg);
+    });
+    if (index == indices.end())
+    {
+        return false;
+    }
+
+    unindexCfg(*index);
+
+    // Move the last configuration into the removed place.
+    auto lastIndex = _cfgs.size() - 1;
+    if (*index != lastIndex)
+    {
+        unindexCfg(lastIndex);
+        _cfgs[*index] = _cfgs[lastIndex];
+        indexCfg(*index);
+    }
+    _cfgs.pop_back();
+    return true;
+}
+
+bool ConfigStore::contains(const DataSyncConfig& dataSyncCfg) const
+{
+    return std::ranges::any_of(findByPath(dataSyncCfg._path),
+                               [&](auto index) {
+        return matches(index, dataSyncCfg);
+    });
+}
+
+bool ConfigStore::matches(std::size_t index,
+                          const DataSyncConfig& dataSyncCfg) const
+{
+    const auto& cfg = _cfgs[index];
+
+    // Compare the packed members first as they are cheaper than the paths.
+    if (syncDirectionOf(cfg) != dataSyncCfg._syncDirection ||
+        syncTypeOf(cfg) != dataSyncCfg._syncType ||
+        cfg._tier != dataSyncCfg._tier ||
+        cfg._compression != dataSyncCfg._compression ||
+        cfg._bandwidthLimit != dataSyncCfg._bandwidthLimit.value_or(0) ||
+        ((cfg._flags & hasPeriodicity) != 0) !=
+            dataSyncCfg._periodicityInSec.has_value() ||
+        ((cfg._flags & hasRetry) != 0) != dataSyncCfg._retry.has_value() ||
+        ((cfg._flags & hasExcludeList) != 0) !=
+            dataSyncCfg._excludeFileList.has_value() ||
+        ((cfg._flags & hasIncludeList) != 0) !=
+            dataSyncCfg._includeFileList.has_value() ||
+        ((cfg._flags & hasMaxSyncLatency) != 0) !=
+            dataSyncCfg._maxSyncLatency.has_value() ||
+        (cfg._destPath != PathPool::noPath) !=
+            dataSyncCfg._destPath.has_value())
+    {
+        return false;
+    }
+
+    if ((dataSyncCfg._periodicityInSec.has_value() &&
+         cfg._periodicityInSec != dataSyncCfg._periodicityInSec->count()) ||
+        (dataSyncCfg._retry.has_value() &&
+         (cfg._retryAttempts != dataSyncCfg._retry->_retryAttempts ||
+          cfg._retryIntervalInSec !=
+              dataSyncCfg._retry->_retryIntervalInSec.count())) ||
+        (dataSyncCfg._excludeFileList.has_value() &&
+         cfg._excludeCount != dataSyncCfg._excludeFileList->size()) ||
+        (dataSyncCfg._includeFileList.has_value() &&
+         cfg._includeCount != dataSyncCfg._includeFileList->size()) ||
+        (dataSyncCfg._maxSyncLatency.has_value() &&
+         cfg._maxSyncLatencyInMs != dataSyncCfg._maxSyncLatency->count()))
+    {
+        return false;
+    }
+
+    if (_pathPool.find(dataSyncCfg._path) != cfg._path ||
+        (dataSyncCfg._destPath.has_value() &&
+         _pathPool.find(*dataSyncCfg._destPath) != cfg._destPath))
+    {
+        return false;
+    }
+
+    auto listPath = _listPaths.begin() + cfg._listOffset;
+    for (const auto* fileList :
+         {&dataSyncCfg._excludeFileList, &dataSyncCfg._includeFileList})
+    {
+        if (!fileList->has_value())
+        {
+            continue;
+        }
+        for (const auto& path : **fileList)
+        {
+            if (_pathPool.find(path) != *listPath++)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<std::size_t> ConfigStore::findByPath(std::string_view path) const
+{
+    auto pathId = _pathPool.find(path);
+    if (pathId >= _pathHeads.size())
+    {
+        return {};
+    }
+    return chain(_pathHeads[pathId], &CompactConfig::_nextOfPath);
+}
+
+std::vector<std::size_t>
+    ConfigStore::findByDestPath(std::string_view destPath) const
+{
+    auto pathId = _pathPool.find(destPath);
+    if (pathId >= _destPathHeads.size())
+    {
+        return {};
+    }
+    return chain(_destPathHeads[pathId], &CompactConfig::_nextOfDestPath);
+}
+
+DataSyncConfig ConfigStore::operator[](std::size_t index) const
+{
+    const auto& cfg = _cfgs[index];
+
+    DataSyncConfig dataSyncCfg;
+    dataSyncCfg._path = _pathPool.path(cfg._path);
+    if (cfg._destPath != PathPool::noPath)
+    {
+        dataSyncCfg._destPath = _pathPool.path(cfg._destPath);
+    }
+
+    dataSyncCfg._syncDirection = syncDirectionOf(cfg);
+    dataSyncCfg._syncType = syncTypeOf(cfg);
+    dataSyncCfg._tier = cfg._tier;
+    dataSyncCfg._compression = cfg._compression;
+
+    if ((cfg._flags & hasMaxSyncLatency) != 0)
+    {
+        dataSyncCfg._maxSyncLatency =
+            std::chrono::milliseconds(cfg._maxSyncLatencyInMs);
+    }
+
+    if (cfg._bandwidthLimit != 0)
+    {
+        dataSyncCfg._bandwidthLimit = cfg._bandwidthLimit;
+    }
+
+    if ((cfg._flags & hasPeriodicity) != 0)
+    {
+        dataSyncCfg._periodicityInSec =
+            std::chrono::seconds(cfg._periodicityInSec);
+    }
+
+    if ((cfg._flags & hasRetry) != 0)
+    {
+        dataSyncCfg._retry = Retry(cfg._retryAttempts,
+                                   std::chrono::seconds(cfg._retryIntervalInSec));
+    }
+
+    auto listPath = _listPaths.begin() + cfg._listOffset;
+    if ((cfg._flags & hasExcludeList) != 0)
+    {
+        auto& excludeList = dataSyncCfg._excludeFileList.emplace();
+        excludeList.reserve(cfg._excludeCount);
+        for (std::uint32_t count = 0; count < cfg._excludeCount; ++count)
+        {
+            excludeList.push_back(_pathPool.path(*listPath++));
+        }
+    }
+    if ((cfg._flags & hasIncludeList) != 0)
+    {
+        auto& includeList = dataSyncCfg._includeFileList.emplace();
+        includeList.reserve(cfg._includeCount);
+        for (std::uint32_t count = 0; count < cfg._includeCount; ++count)
+        {
+            includeList.push_back(_pathPool.path(*listPath++));
+        }
+    }
+
+    return dataSyncCfg;
+}
+
+std::vector<std::size_t>
+    ConfigStore::chain(std::uint32_t head,
+                       std::uint32_t CompactConfig::*next) const
+{
+    std::vector<std::size_t> indices;
+    for (auto index = head; index != noCfg; index = _cfgs[index].*next)
+    {
+        indices.push_back(index);
+    }
+    return indices;
+}
+
+void ConfigStore::indexCfg(std::size_t index)
+{
+    // The heads are indexed by the path id, hence grow them with the pool.
+    _pathHeads.resize(_pathPool.size(), noCfg);
+    _destPathHeads.resize(_pathPool.size(), noCfg);
+
+    auto& cfg = _cfgs[index];
+    cfg._nextOfPath = std::exchange(_pathHeads[cfg._path],
+                                    static_cast<std::uint32_t>(index));
+    cfg._nextOfDestPath = std::exchange(_destPathHeads[destPathOf(cfg)],
+                                        static_cast<std::uint32_t>(index));
+
+    _syncModeIndex[syncModeBucket(syncTypeOf(cfg), syncDirectionOf(cfg))]
+        .push_back(static_cast<std::uint32_t>(index));
+}
+
+void ConfigStore::unindexCfg(std::size_t index)
+{
+    const auto& cfg = _cfgs[index];
+
+    // Unlink the configuration from the chain of the given head.
+    auto unlink = [this, index](std::uint32_t& head,
+                                std::uint32_t CompactConfig::*next) {
+        auto* link = &head;
+        while (*link != index)
+        {
+            link = &(_cfgs[*link].*next);
+        }
+        *link = _cfgs[index].*next;
+    };
+    unlink(_pathHeads[cfg._path], &CompactConfig::_nextOfPath);
+    unlink(_destPathHeads[destPathOf(cfg)], &CompactConfig::_nextOfDestPath);
+
+    std::erase(
+        _syncModeIndex[syncModeBucket(syncTypeOf(cfg), syncDirectionOf(cfg))],
+        index);
+}
+
+} // namespace data_sync::config
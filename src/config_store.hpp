@@ -0,0 +1,404 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+#include "path_pool.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+namespace data_sync::config
+{
+
+/**
+ * @class ConfigStore
+ *
+ * @brief The class stores the data sync configurations in a dense array of
+ *        compact records and indexes them to look up the configurations
+ *        without scanning all of them.
+ *
+ *        - The paths, the destination paths and the include and exclude
+ *          lists are interned into a prefix sharing path pool and referred
+ *          by the ids, the lists of all the configurations share a single
+ *          array of the ids.
+ *        - The sync direction, the sync type and the presence of the
+ *          optional members are packed into a byte.
+ *        - The configurations of the same path and the same destination path
+ *          are chained from the path id, the chains are short as the path is
+ *          unique unless the planner keeps the conflicting configurations of
+ *          the same path.
+ *        - The sync type and the sync direction are indexed by a bucket for
+ *          each combination.
+ *
+ * @note The indices returned by the lookups are invalidated once
+ *       a configuration is removed.
+ */
+class ConfigStore
+{
+  public:
+    ConfigStore() = default;
+
+    /**
+     * @brief The constructor stores and indexes the given configurations.
+     *
+     * @param[in] dataSyncCfgs - The data sync configurations
+     */
+    explicit ConfigStore(const std::vector<DataSyncConfig>& dataSyncCfgs);
+
+    /**
+     * @brief Add the given configuration.
+     *
+     * @param[in] dataSyncCfg - The data sync configuration to add
+     *
+     * @return The index of the added configuration.
+     */
+    std::size_t add(const DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief Remove the given configuration.
+     *
+     *        The last configuration is moved into the place of the removed
+     *        one to keep the array dense.
+     *
+     * @param[in] dataSyncCfg - The data sync configuration to remove
+     *
+     * @return True if removed; otherwise False.
+     *
+     * @note The interned paths and the list ids of the removed configuration
+     *       are kept until the store is rebuilt.
+     */
+    bool remove(const DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief Check whether the store contains the given configuration.
+     *
+     * @param[in] dataSyncCfg - The data sync configuration to check
+     *
+     * @return True if contains; otherwise False.
+     */
+    bool contains(const DataSyncConfig& dataSyncCfg) const;
+
+    /**
+     * @brief Check whether the configuration at the given index matches the
+     *        given configuration without restoring it.
+     *
+     * @param[in] index - The index of the configuration
+     * @param[in] dataSyncCfg - The data sync configuration to compare
+     *
+     * @return True if it matches; otherwise, False.
+     */
+    bool matches(std::size_t index, const DataSyncConfig& dataSyncCfg) const;
+
+    /**
+     * @brief Find the configurations of the given path.
+     *
+     * @param[in] path - The path to find
+     *
+     * @return The indices of the matched configurations.
+     */
+    std::vector<std::size_t> findByPath(std::string_view path) const;
+
+    /**
+     * @brief Find the configurations which sync to the given destination
+     *        path, the path is the destination if no destination is
+     *        configured.
+     *
+     * @param[in] destPath - The destination path to find
+     *
+     * @return The indices of the matched configurations.
+     */
+    std::vector<std::size_t> findByDestPath(std::string_view destPath) const;
+
+    /**
+     * @brief Find the configurations of the given sync type and direction.
+     *
+     * @param[in] syncType - The sync type
+     * @param[in] syncDirection - The sync direction
+     *
+     * @return The indices of the matched configurations.
+     */
+    const std::vector<std::uint32_t>&
+        findBySyncMode(SyncType syncType, SyncDirection syncDirection) const
+    {
+        return _syncModeIndex[syncModeBucket(syncType, syncDirection)];
+    }
+
+    /**
+     * @brief Get the full sync tier of the configuration at the given index
+     *        without restoring it.
+     *
+     * @param[in] index - The index of the configuration
+     *
+     * @return The tier
+     */
+    std::uint8_t tier(std::size_t index) const
+    {
+        return _cfgs[index]._tier;
+    }
+
+    /**
+     * @brief Get the configuration at the given index.
+     *
+     * @param[in] index - The index of the configuration
+     *
+     * @return The configuration restored from the compact record.
+     */
+    DataSyncConfig operator[](std::size_t index) const;
+
+    /**
+     * @brief Get the number of the configurations.
+     */
+    std::size_t size() const
+    {
+        return _cfgs.size();
+    }
+
+    /**
+     * @brief Check whether the store is empty.
+     */
+    bool empty() const
+    {
+        return _cfgs.empty();
+    }
+
+    /**
+     * @brief Get a view of all the configurations restored from the compact
+     *        records.
+     */
+    auto configs() const
+    {
+        return std::views::iota(std::size_t{0}, size()) |
+               std::views::transform(
+                   [this](std::size_t index) { return (*this)[index]; });
+    }
+
+  private:
+    using PathId = PathPool::PathId;
+
+    /**
+     * @brief The id which refers to no configuration.
+     */
+    static constexpr std::uint32_t noCfg = PathPool::noPath;
+
+    /**
+     * @brief The flags of the compact record.
+     */
+    enum Flags : std::uint8_t
+    {
+        syncDirectionMask = 0x03,
+        periodicSyncType = 0x04,
+        hasPeriodicity = 0x08,
+        hasRetry = 0x10,
+        hasExcludeList = 0x20,
+        hasIncludeList = 0x40,
+        hasMaxSyncLatency = 0x80
+    };
+
+    /**
+     * @brief The structure contains a data sync configuration in the compact
+     *        form.
+     */
+    struct CompactConfig
+    {
+        /**
+         * @brief The interval (in seconds) to sync periodically.
+         */
+        std::int64_t _periodicityInSec{0};
+
+        /**
+         * @brief The retry interval in seconds.
+         */
+        std::int64_t _retryIntervalInSec{0};
+
+        /**
+         * @brief The maximum latency (in milliseconds) to sync the changed
+         *        data.
+         */
+        std::int64_t _maxSyncLatencyInMs{0};
+
+        /**
+         * @brief The bandwidth limit in KiB per second, zero if not
+         *        configured.
+         */
+        std::uint32_t _bandwidthLimit{0};
+
+        /**
+         * @brief The id of the path.
+         */
+        PathId _path{PathPool::noPath};
+
+        /**
+         * @brief The id of the destination path, noPath if not configured.
+         */
+        PathId _destPath{PathPool::noPath};
+
+        /**
+         * @brief The offset of the exclude list followed by the include list
+         *        in the list ids.
+         */
+        std::uint32_t _listOffset{0};
+
+        /**
+         * @brief The number of the paths in the exclude list.
+         */
+        std::uint32_t _excludeCount{0};
+
+        /**
+         * @brief The number of the paths in the include list.
+         */
+        std::uint32_t _includeCount{0};
+
+        /**
+         * @brief The next configuration of the same path.
+         */
+        std::uint32_t _nextOfPath{noCfg};
+
+        /**
+         * @brief The next configuration of the same destination path.
+         */
+        std::uint32_t _nextOfDestPath{noCfg};
+
+        /**
+         * @brief The number of retries.
+         */
+        std::uint8_t _retryAttempts{0};
+
+        /**
+         * @brief The packed sync direction, sync type and presence flags.
+         */
+        std::uint8_t _flags{0};
+
+        /**
+         * @brief The full sync tier.
+         */
+        std::uint8_t _tier{criticalTier};
+
+        /**
+         * @brief The compression policy of the transfer.
+         */
+        Compression _compression{Compression::Auto};
+    };
+
+    /**
+     * @brief The number of the sync type and sync direction combinations.
+     */
+    static constexpr std::size_t syncModeBuckets = 2 * 3;
+
+    /**
+     * @brief Get the bucket of the given sync type and direction.
+     *
+     * @param[in] syncType - The sync type
+     * @param[in] syncDirection - The sync direction
+     *
+     * @return The bucket index
+     */
+    static constexpr std::size_t syncModeBucket(SyncType syncType,
+                                                SyncDirection syncDirection)
+    {
+        return (static_cast<std::size_t>(syncType) * 3) +
+               static_cast<std::size_t>(syncDirection);
+    }
+
+    /**
+     * @brief Get the sync type of the given configuration.
+     *
+     * @param[in] cfg - The compact configuration
+     *
+     * @return The sync type
+     */
+    static SyncType syncTypeOf(const CompactConfig& cfg)
+    {
+        return (cfg._flags & periodicSyncType) != 0 ? SyncType::Periodic
+                                                     : SyncType::Immediate;
+    }
+
+    /**
+     * @brief Get the sync direction of the given configuration.
+     *
+     * @param[in] cfg - The compact configuration
+     *
+     * @return The sync direction
+     */
+    static SyncDirection syncDirectionOf(const CompactConfig& cfg)
+    {
+        return static_cast<SyncDirection>(cfg._flags & syncDirectionMask);
+    }
+
+    /**
+     * @brief Get the id of the destination path of the given configuration,
+     *        the path is the destination if no destination is configured.
+     *
+     * @param[in] cfg - The compact configuration
+     *
+     * @return The id of the destination path
+     */
+    static PathId destPathOf(const CompactConfig& cfg)
+    {
+        return cfg._destPath != PathPool::noPath ? cfg._destPath : cfg._path;
+    }
+
+    /**
+     * @brief A helper API to collect the configurations chained from the
+     *        given head.
+     *
+     * @param[in] head - The first configuration of the chain
+     * @param[in] next - The member which links the chain
+     *
+     * @return The indices of the chained configurations.
+     */
+    std::vector<std::size_t> chain(std::uint32_t head,
+                                   std::uint32_t CompactConfig::*next) const;
+
+    /**
+     * @brief A helper API to add the given configuration into the indexes.
+     *
+     * @param[in] index - The index of the configuration
+     */
+    void indexCfg(std::size_t index);
+
+    /**
+     * @brief A helper API to remove the given configuration from
+     *        the indexes.
+     *
+     * @param[in] index - The index of the configuration
+     */
+    void unindexCfg(std::size_t index);
+
+    /**
+     * @brief The pool of all the interned paths.
+     */
+    PathPool _pathPool;
+
+    /**
+     * @brief The compact data sync configurations.
+     */
+    std::vector<CompactConfig> _cfgs;
+
+    /**
+     * @brief The path ids of the include and exclude lists of all the
+     *        configurations.
+     */
+    std::vector<PathId> _listPaths;
+
+    /**
+     * @brief The first configuration of each path id.
+     */
+    std::vector<std::uint32_t> _pathHeads;
+
+    /**
+     * @brief The first configuration of each destination path id.
+     */
+    std::vector<std::uint32_t> _destPathHeads;
+
+    /**
+     * @brief The index of the configurations by the sync type and direction.
+     */
+    std::array<std::vector<std::uint32_t>, syncModeBuckets> _syncModeIndex;
+};
+
+} // namespace data_sync::config
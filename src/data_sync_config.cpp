@@ -4,9 +4,9 @@
 
 #include "data_sync_config.hpp"
 
-#include <phosphor-logging/lg2.hpp>
+#include "iso_duration.hpp"
 
-#include <regex>
+#include <phosphor-logging/lg2.hpp>
 
 namespace data_sync::config
 {
@@ -42,10 +42,11 @@ DataSyncConfig::DataSyncConfig(const nlohmann::json& config) :
 
     if (_syncType == SyncType::Periodic)
     {
-        constexpr auto defPeriodicity = 60;
+        constexpr auto defPeriodicity =
+            std::chrono::ceil<std::chrono::seconds>(*parseISODuration("PT1M"));
         _periodicityInSec =
             convertISODurationToSec(config["Periodicity"].get<std::string>())
-                .value_or(std::chrono::seconds(defPeriodicity));
+                .value_or(defPeriodicity);
     }
     else
     {
@@ -83,6 +84,56 @@ DataSyncConfig::DataSyncConfig(const nlohmann::json& config) :
     {
         _includeFileList = std::nullopt;
     }
+
+    if (config.contains("Tier"))
+    {
+        auto tier = config["Tier"].get<unsigned int>();
+        if (tier > maxTier)
+        {
+            lg2::error("Unsupported tier [{TIER}] of the path [{PATH}], using "
+                       "the tier {MAX_TIER}",
+                       "TIER", tier, "PATH", _path, "MAX_TIER", maxTier);
+            tier = maxTier;
+        }
+        _tier = static_cast<std::uint8_t>(tier);
+    }
+
+    if (config.contains("MaxSyncLatency"))
+    {
+        _maxSyncLatency =
+            convertISODurationToMs(config["MaxSyncLatency"].get<std::string>());
+    }
+    else
+    {
+        _maxSyncLatency = std::nullopt;
+    }
+
+    if (config.contains("BandwidthLimit"))
+    {
+        auto bandwidthLimit = config["BandwidthLimit"].get<std::uint32_t>();
+        if (bandwidthLimit == 0)
+        {
+            lg2::error("Unsupported bandwidth limit [0] of the path [{PATH}], "
+                       "syncing without the limit",
+                       "PATH", _path);
+            _bandwidthLimit = std::nullopt;
+        }
+        else
+        {
+            _bandwidthLimit = bandwidthLimit;
+        }
+    }
+    else
+    {
+        _bandwidthLimit = std::nullopt;
+    }
+
+    if (config.contains("Compression"))
+    {
+        _compression =
+            convertCompressionToEnum(config["Compression"].get<std::string>())
+                .value_or(Compression::Auto);
+    }
 }
 
 bool DataSyncConfig::operator==(const DataSyncConfig& dataSyncCfg) const
@@ -94,7 +145,11 @@ bool DataSyncConfig::operator==(const DataSyncConfig& dataSyncCfg) const
            _periodicityInSec == dataSyncCfg._periodicityInSec &&
            _retry == dataSyncCfg._retry &&
            _excludeFileList == dataSyncCfg._excludeFileList &&
-           _includeFileList == dataSyncCfg._includeFileList;
+           _includeFileList == dataSyncCfg._includeFileList &&
+           _tier == dataSyncCfg._tier &&
+           _maxSyncLatency == dataSyncCfg._maxSyncLatency &&
+           _bandwidthLimit == dataSyncCfg._bandwidthLimit &&
+           _compression == dataSyncCfg._compression;
 }
 
 std::optional<SyncDirection>
@@ -139,29 +194,58 @@ std::optional<SyncType>
     }
 }
 
+std::optional<Compression>
+    DataSyncConfig::convertCompressionToEnum(const std::string& compression)
+{
+    if (compression == "Auto")
+    {
+        return Compression::Auto;
+    }
+    else if (compression == "Off")
+    {
+        return Compression::Off;
+    }
+    else if (compression == "Fast")
+    {
+        return Compression::Fast;
+    }
+    else if (compression == "Strong")
+    {
+        return Compression::Strong;
+    }
+    else
+    {
+        lg2::error("Unsupported compression [{COMPRESSION}]", "COMPRESSION",
+                   compression);
+        return std::nullopt;
+    }
+}
+
 std::optional<std::chrono::seconds> DataSyncConfig::convertISODurationToSec(
     const std::string& timeIntervalInISO)
 {
-    // TODO: Parse periodicity in ISO 8601 duration format using
-    // std::chrono::parse, as the API is not available in the current gcc
-    // compiler (13.3.0).
-    std::smatch match;
-    std::regex isoDurationRegex("PT(([0-9]+)H)?(([0-9]+)M)?(([0-9]+)S)?");
-
-    if (std::regex_search(timeIntervalInISO, match, isoDurationRegex))
+    auto duration = convertISODurationToMs(timeIntervalInISO);
+    if (!duration.has_value())
     {
-        return (std::chrono::seconds(
-            (match.str(2).empty() ? 0 : (std::stoi(match.str(2)) * 60 * 60)) +
-            (match.str(4).empty() ? 0 : (std::stoi(match.str(4)) * 60)) +
-            (match.str(6).empty() ? 0 : std::stoi(match.str(6)))));
+        return std::nullopt;
     }
-    else
+
+    // Round up the fraction of a second to avoid syncing continuously if
+    // the duration is less than a second.
+    return std::chrono::ceil<std::chrono::seconds>(*duration);
+}
+
+std::optional<std::chrono::milliseconds>
+    DataSyncConfig::convertISODurationToMs(const std::string& timeIntervalInISO)
+{
+    auto duration = parseISODuration(timeIntervalInISO);
+    if (!duration.has_value())
     {
         lg2::error("{TIME_INTERVAL} is not matching with expected "
-                   "ISO 8601 duration format [PTnHnMnS]",
+                   "ISO 8601 duration format [PnW or PnDTnHnMnS]",
                    "TIME_INTERVAL", timeIntervalInISO);
-        return std::nullopt;
     }
+    return duration;
 }
 
 } // namespace data_sync::config
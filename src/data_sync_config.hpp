@@ -5,6 +5,7 @@
 #include <nlohmann/json.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -31,6 +32,29 @@ enum class SyncType
     Periodic
 };
 
+/**
+ * @brief The enum contains all the compression policies of the transfer,
+ *        in the order of the compression effort.
+ */
+enum class Compression : std::uint8_t
+{
+    Auto,
+    Off,
+    Fast,
+    Strong
+};
+
+/**
+ * @brief The full sync tier of the most critical data, the data of a tier
+ *        is synced by the full sync before the data of the next tiers.
+ */
+constexpr std::uint8_t criticalTier = 0;
+
+/**
+ * @brief The full sync tier of the least critical data.
+ */
+constexpr std::uint8_t maxTier = 7;
+
 /**
  * @brief The structure contains all retry-related details
  *        specific to a file or directory to retry if failed to sync.
@@ -75,6 +99,12 @@ struct Retry
 struct DataSyncConfig
 {
   public:
+    /**
+     * @brief The default constructor used to build the configuration from
+     *        a non JSON source like the config cache.
+     */
+    DataSyncConfig() = default;
+
     /**
      * @brief The constructor initializes members using the configuration.
      *
@@ -140,12 +170,12 @@ struct DataSyncConfig
     /**
      * @brief Used to get sync direction.
      */
-    SyncDirection _syncDirection;
+    SyncDirection _syncDirection{SyncDirection::Active2Passive};
 
     /**
      * @brief Used to get sync type.
      */
-    SyncType _syncType;
+    SyncType _syncType{SyncType::Immediate};
 
     /**
      * @brief The interval (in seconds) to sync periodically.
@@ -178,6 +208,39 @@ struct DataSyncConfig
      */
     std::optional<std::vector<std::string>> _includeFileList;
 
+    /**
+     * @brief The full sync tier of the data, the lower tier is more critical
+     *        to fail over and it is synced first.
+     *
+     * @note The data is in the critical tier by default so that the
+     *       critical tier covers all the data unless the less critical data
+     *       opts into the later tiers.
+     */
+    std::uint8_t _tier{criticalTier};
+
+    /**
+     * @brief The maximum latency to sync the changed data.
+     *
+     * @note Holds a value if the specific file or directory uses a custom
+     *       latency target, otherwise the default latency of the sync type
+     *       is used.
+     */
+    std::optional<std::chrono::milliseconds> _maxSyncLatency;
+
+    /**
+     * @brief The bandwidth limit (in KiB per second) to sync the data.
+     *
+     * @note Holds a value if the specific file or directory is rate limited
+     *       on its own, otherwise only the global rate limit applies.
+     */
+    std::optional<std::uint32_t> _bandwidthLimit;
+
+    /**
+     * @brief The compression policy of the transfer, it is decided per
+     *        transfer by default.
+     */
+    Compression _compression{Compression::Auto};
+
   private:
     /**
      * @brief A helper API to retrieve the corresponding enum type
@@ -201,16 +264,40 @@ struct DataSyncConfig
     static std::optional<SyncType>
         convertSyncTypeToEnum(const std::string& syncType);
 
+    /**
+     * @brief A helper API to retrieve the corresponding enum type
+     *        for a given compression string.
+     *
+     * @param[in] - compression - the compression policy
+     *
+     * @returns The enum value on success; otherwise, nullopt.
+     */
+    static std::optional<Compression>
+        convertCompressionToEnum(const std::string& compression);
+
     /**
      * @brief A helper API to convert the time duration in ISO 8601 duration
      *        format into seconds
      *
      * @param[in] - timeIntervalInISO - The time duration
      *
-     * @returns The time interval in seconds on success; otherwise, nullopt.
+     * @returns The time interval in seconds, rounded up to the next second,
+     *          on success; otherwise, nullopt.
      */
     static std::optional<std::chrono::seconds>
         convertISODurationToSec(const std::string& timeIntervalInISO);
+
+    /**
+     * @brief A helper API to convert the time duration in ISO 8601 duration
+     *        format into milliseconds
+     *
+     * @param[in] - timeIntervalInISO - The time duration
+     *
+     * @returns The time interval in milliseconds on success; otherwise,
+     *          nullopt.
+     */
+    static std::optional<std::chrono::milliseconds>
+        convertISODurationToMs(const std::string& timeIntervalInISO);
 };
 
 } // namespace data_sync::config
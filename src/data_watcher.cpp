@@ -0,0 +1,310 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "data_watcher.hpp"
+
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <ranges>
+#include <system_error>
+
+namespace data_sync::watch::inotify
+{
+
+DataWatcher::DataWatcher(sdbusplus::async::context& ctx, int inotifyFlags) :
+    _inotifyFileDescriptor(inotify_init1(inotifyFlags | IN_NONBLOCK))
+{
+    if (_inotifyFileDescriptor() < 0)
+    {
+        throw std::system_error(errno, std::generic_category(),
+                                "inotify_init1 failed");
+    }
+    _fdioInstance = std::make_unique<sdbusplus::async::fdio>(
+        ctx, _inotifyFileDescriptor());
+}
+
+DataWatcher::DataWatcher(sdbusplus::async::context& ctx, int inotifyFlags,
+                         EventMask eventMasksToWatch,
+                         const fs::path& dataPathToWatch) :
+    DataWatcher(ctx, inotifyFlags)
+{
+    if (!addWatch(dataPathToWatch, eventMasksToWatch).has_value())
+    {
+        throw std::system_error(errno, std::generic_category(),
+                                "inotify_add_watch failed for " +
+                                    dataPathToWatch.string());
+    }
+}
+
+std::optional<WD> DataWatcher::addWatch(const fs::path& dataPathToWatch,
+                                        EventMask eventMasksToWatch)
+{
+    WD wd = inotify_add_watch(_inotifyFileDescriptor(),
+                              dataPathToWatch.c_str(), eventMasksToWatch);
+    if (wd < 0)
+    {
+        lg2::error("Failed to add the inotify watch for {PATH}, errno: {ERRNO}",
+                   "PATH", dataPathToWatch, "ERRNO", errno);
+        return std::nullopt;
+    }
+    _watchedPaths.insert_or_assign(wd, dataPathToWatch);
+    return wd;
+}
+
+bool DataWatcher::watchDataPath(const fs::path& dataPath,
+                                EventMask eventMasksToWatch)
+{
+    // The directory may be configured with the trailing separator.
+    _dataPath = dataPath.lexically_normal();
+    if (!_dataPath->has_filename())
+    {
+        _dataPath = _dataPath->parent_path();
+    }
+    _dataPathMask = eventMasksToWatch;
+    return armDataPath();
+}
+
+bool DataWatcher::armDataPath()
+{
+    for (const auto& wd : _watchedPaths | std::views::keys)
+    {
+        inotify_rm_watch(_inotifyFileDescriptor(), wd);
+    }
+    _watchedPaths.clear();
+
+    constexpr EventMask selfMask = IN_DELETE_SELF | IN_MOVE_SELF;
+    std::error_code ec;
+    while (true)
+    {
+        auto dataPathStatus = fs::symlink_status(*_dataPath, ec);
+        if (fs::is_directory(dataPathStatus))
+        {
+            _dataPathWatch = DataPathWatch::Tree;
+            return addWatchTree(*_dataPath);
+        }
+        if (fs::exists(dataPathStatus))
+        {
+            _dataPathWatch = DataPathWatch::Parent;
+            return addWatch(_dataPath->parent_path(),
+                            _dataPathMask | IN_ONLYDIR | selfMask)
+                .has_value();
+        }
+
+        _dataPathWatch = DataPathWatch::Ancestor;
+        auto ancestor = _dataPath->parent_path();
+        while (ancestor.has_relative_path() && !fs::is_directory(ancestor, ec))
+        {
+            ancestor = ancestor.parent_path();
+        }
+        auto wd = addWatch(ancestor,
+                           IN_CREATE | IN_MOVED_TO | IN_ONLYDIR | selfMask);
+        if (!wd.has_value())
+        {
+            return false;
+        }
+
+        // Look up again if the next path component is created before the
+        // ancestor is watched.
+        auto nextPath = ancestor /
+                        *_dataPath->lexically_relative(ancestor).begin();
+        if (!fs::exists(fs::symlink_status(nextPath, ec)))
+        {
+            return true;
+        }
+        removeWatch(*wd);
+    }
+}
+
+bool DataWatcher::addWatchTree(const fs::path& dir)
+{
+    constexpr EventMask dirMask = IN_ONLYDIR | IN_DELETE_SELF | IN_MOVE_SELF;
+    if (!addWatch(dir, _dataPathMask | dirMask).has_value())
+    {
+        return false;
+    }
+
+    // The symbolic links are synced as is, hence not followed.
+    std::error_code ec;
+    for (auto entry = fs::recursive_directory_iterator(
+             dir, fs::directory_options::skip_permission_denied, ec);
+         !ec && entry != fs::recursive_directory_iterator();
+         entry.increment(ec))
+    {
+        if (entry->is_directory(ec) && !entry->is_symlink(ec))
+        {
+            addWatch(entry->path(), _dataPathMask | dirMask);
+        }
+    }
+    return true;
+}
+
+std::vector<EventInfo>
+    DataWatcher::trackDataPath(std::vector<EventInfo> events)
+{
+    std::vector<EventInfo> dataEvents;
+    std::optional<EventInfo> rearmEvent;
+    for (auto& event : events)
+    {
+        // The events of the removed watches are stale.
+        if (event._path.empty() || rearmEvent.has_value())
+        {
+            continue;
+        }
+
+        auto selfEvent =
+            event._name.empty() &&
+            (event._mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) != 0;
+        switch (_dataPathWatch)
+        {
+            case DataPathWatch::Tree:
+                // The removal of a subdirectory is reported by its parent.
+                if (selfEvent)
+                {
+                    if (event._path == *_dataPath)
+                    {
+                        rearmEvent = std::move(event);
+                    }
+                    break;
+                }
+                if ((event._mask & IN_ISDIR) != 0 &&
+                    (event._mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+                {
+                    addWatchTree(event._path);
+                }
+                dataEvents.push_back(std::move(event));
+                break;
+            case DataPathWatch::Parent:
+                if (selfEvent)
+                {
+                    rearmEvent = std::move(event);
+                }
+                else if (event._path == *_dataPath)
+                {
+                    dataEvents.push_back(std::move(event));
+                }
+                break;
+            case DataPathWatch::Ancestor:
+                // The event of the next path component to the data path.
+                if (selfEvent ||
+                    std::ranges::mismatch(event._path, *_dataPath).in1 ==
+                        event._path.end())
+                {
+                    rearmEvent = std::move(event);
+                }
+                break;
+        }
+    }
+
+    if (rearmEvent.has_value())
+    {
+        if (!armDataPath())
+        {
+            lg2::error("Unable to watch the data path {PATH} again", "PATH",
+                       *_dataPath);
+        }
+
+        // The data is changed as a whole unless it is still missing.
+        if (_dataPathWatch != DataPathWatch::Ancestor)
+        {
+            rearmEvent->_path = *_dataPath;
+            rearmEvent->_name.clear();
+            dataEvents.push_back(std::move(*rearmEvent));
+        }
+    }
+    return dataEvents;
+}
+
+void DataWatcher::removeWatch(WD wd)
+{
+    _watchedPaths.erase(wd);
+    if (inotify_rm_watch(_inotifyFileDescriptor(), wd) < 0)
+    {
+        lg2::debug("Failed to remove the inotify watch {WD}, errno: {ERRNO}",
+                   "WD", wd, "ERRNO", errno);
+    }
+}
+
+sdbusplus::async::task<std::vector<EventInfo>>
+    // NOLINTNEXTLINE
+    DataWatcher::onDataChange(std::stop_token stopToken)
+{
+    if (stopToken.stop_requested())
+    {
+        co_return std::vector<EventInfo>{};
+    }
+
+    // The removed watches are reported as ignored, which wakes up the wait
+    // once stopped rather than waiting for the next change of the data.
+    std::stop_callback removeWatches(stopToken, [this]() {
+        for (const auto& wd : _watchedPaths | std::views::keys)
+        {
+            inotify_rm_watch(_inotifyFileDescriptor(), wd);
+        }
+        _watchedPaths.clear();
+    });
+
+    // NOLINTNEXTLINE
+    co_await _fdioInstance->next();
+    if (stopToken.stop_requested())
+    {
+        co_return std::vector<EventInfo>{};
+    }
+    co_return _dataPath.has_value() ? trackDataPath(readEvents())
+                                    : readEvents();
+}
+
+std::vector<EventInfo> DataWatcher::readEvents()
+{
+    std::vector<EventInfo> events;
+
+    // The buffer must be aligned as inotify_event to read it in place.
+    alignas(inotify_event) std::array<char, 4096> buffer{};
+
+    while (true)
+    {
+        auto bytes = read(_inotifyFileDescriptor(), buffer.data(),
+                          buffer.size());
+        if (bytes <= 0)
+        {
+            if (bytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                lg2::error("Failed to read the inotify events, errno: {ERRNO}",
+                           "ERRNO", errno);
+            }
+            break;
+        }
+
+        for (auto offset = 0L; offset < bytes;)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            const auto* event = reinterpret_cast<const inotify_event*>(
+                std::next(buffer.data(), offset));
+            std::string name = event->len > 0 ? event->name : "";
+            fs::path path;
+            auto watchedPath = _watchedPaths.find(event->wd);
+            if (watchedPath != _watchedPaths.end())
+            {
+                path = name.empty() ? watchedPath->second
+                                    : watchedPath->second / name;
+            }
+            events.emplace_back(event->wd, event->mask, std::move(name),
+                                std::move(path));
+
+            // The watch is removed by the kernel once the watched path is
+            // deleted or unmounted.
+            if ((event->mask & IN_IGNORED) != 0)
+            {
+                _watchedPaths.erase(event->wd);
+            }
+            offset += static_cast<long>(sizeof(inotify_event) + event->len);
+        }
+    }
+
+    return events;
+}
+
+} // namespace data_sync::watch::inotify
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "fd.hpp"
+
+#include <sys/inotify.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+namespace data_sync::watch::inotify
+{
+
+namespace fs = std::filesystem;
+
+using WD = int;
+using EventMask = uint32_t;
+
+/**
+ * @brief The structure holds the details of a single inotify event.
+ */
+struct EventInfo
+{
+    /**
+     * @brief The watch descriptor on which the event occurred.
+     */
+    WD _wd;
+
+    /**
+     * @brief The inotify event mask.
+     */
+    EventMask _mask;
+
+    /**
+     * @brief The name of the entry inside the watched directory.
+     *
+     * @note Empty if the event is for the watched path itself.
+     */
+    std::string _name;
+
+    /**
+     * @brief The path on which the event occurred, the watched path joined
+     *        with the name.
+     *
+     * @note Empty if the watch is already removed.
+     */
+    fs::path _path;
+};
+
+/**
+ * @class DataWatcher
+ *
+ * @brief The class monitors the given paths using inotify and reports the
+ *        occurred events asynchronously.
+ */
+class DataWatcher
+{
+  public:
+    DataWatcher(const DataWatcher&) = delete;
+    DataWatcher& operator=(const DataWatcher&) = delete;
+    DataWatcher(DataWatcher&&) = delete;
+    DataWatcher& operator=(DataWatcher&&) = delete;
+    ~DataWatcher() = default;
+
+    /**
+     * @brief The constructor creates the inotify instance.
+     *
+     * @param[in] ctx - The async context
+     * @param[in] inotifyFlags - The flags to initialize the inotify instance
+     *
+     * @note IN_NONBLOCK is always added as the events are read until the
+     *       queue is drained.
+     *
+     * @throw std::system_error if the inotify instance is not created.
+     */
+    DataWatcher(sdbusplus::async::context& ctx, int inotifyFlags);
+
+    /**
+     * @brief The constructor creates the inotify instance and adds the given
+     *        path to the watch list.
+     *
+     * @param[in] ctx - The async context
+     * @param[in] inotifyFlags - The flags to initialize the inotify instance
+     * @param[in] eventMasksToWatch - The events to watch
+     * @param[in] dataPathToWatch - The path to watch
+     *
+     * @throw std::system_error if the inotify instance is not created or the
+     *        path is not added to the watch list.
+     */
+    DataWatcher(sdbusplus::async::context& ctx, int inotifyFlags,
+                EventMask eventMasksToWatch, const fs::path& dataPathToWatch);
+
+    /**
+     * @brief Add the given path to the watch list.
+     *
+     * @param[in] dataPathToWatch - The path to watch
+     * @param[in] eventMasksToWatch - The events to watch
+     *
+     * @return The watch descriptor on success; otherwise, nullopt.
+     */
+    std::optional<WD> addWatch(const fs::path& dataPathToWatch,
+                               EventMask eventMasksToWatch);
+
+    /**
+     * @brief Watch the given data path to sync along with its subdirectories.
+     *
+     *        - A directory is watched recursively and the subdirectories
+     *          created later are watched once they are reported.
+     *        - A file is watched by its parent directory and only the events
+     *          of it are reported so that it is not lost once it is replaced
+     *          by renaming another file over it.
+     *        - A missing path is waited for by watching its nearest existing
+     *          ancestor, the events of it are reported once it is created.
+     *        - The watches are armed again once the watched path is removed
+     *          or moved away.
+     *
+     * @param[in] dataPath - The data path to watch
+     * @param[in] eventMasksToWatch - The events to watch
+     *
+     * @return True if watched; otherwise False.
+     */
+    bool watchDataPath(const fs::path& dataPath, EventMask eventMasksToWatch);
+
+    /**
+     * @brief Remove the given watch descriptor from the watch list.
+     *
+     * @param[in] wd - The watch descriptor to remove
+     */
+    void removeWatch(WD wd);
+
+    /**
+     * @brief Wait until the watched paths change.
+     *
+     * @param[in] stopToken - The token to stop waiting, the watches are
+     *                        removed once it is requested so that the wait
+     *                        is woken up by the removal events
+     *
+     * @return The list of occurred events, empty if stopped.
+     */
+    sdbusplus::async::task<std::vector<EventInfo>>
+        onDataChange(std::stop_token stopToken = {});
+
+  private:
+    /**
+     * @brief A helper API to read all the pending events from the inotify
+     *        file descriptor.
+     *
+     * @return The list of events.
+     */
+    std::vector<EventInfo> readEvents();
+
+    /**
+     * @brief The way in which the data path is watched.
+     */
+    enum class DataPathWatch
+    {
+        Tree,
+        Parent,
+        Ancestor
+    };
+
+    /**
+     * @brief A helper API to watch the data path as it is present now, the
+     *        previous watches are removed.
+     *
+     * @return True if watched; otherwise False.
+     */
+    bool armDataPath();
+
+    /**
+     * @brief A helper API to watch the given directory and its
+     *        subdirectories.
+     *
+     * @param[in] dir - The directory to watch
+     *
+     * @return True if the directory is watched; otherwise False.
+     */
+    bool addWatchTree(const fs::path& dir);
+
+    /**
+     * @brief A helper API to keep the watches of the data path up to date
+     *        by the given events and filter the events of the data path.
+     *
+     * @param[in] events - The read events
+     *
+     * @return The events of the data path.
+     */
+    std::vector<EventInfo> trackDataPath(std::vector<EventInfo> events);
+
+    /**
+     * @brief The inotify file descriptor
+     */
+    FD _inotifyFileDescriptor;
+
+    /**
+     * @brief The async fd handler to wait for the inotify events.
+     */
+    std::unique_ptr<sdbusplus::async::fdio> _fdioInstance;
+
+    /**
+     * @brief The watched path of each watch descriptor.
+     */
+    std::map<WD, fs::path> _watchedPaths;
+
+    /**
+     * @brief The data path watched by watchDataPath(), unset otherwise.
+     */
+    std::optional<fs::path> _dataPath;
+
+    /**
+     * @brief The events to watch of the data path.
+     */
+    EventMask _dataPathMask = 0;
+
+    /**
+     * @brief The way in which the data path is watched currently.
+     */
+    DataPathWatch _dataPathWatch = DataPathWatch::Tree;
+};
+
+} // namespace data_sync::watch::inotify
@@ -53,4 +53,18 @@ const RbmcCredentials& ExternalDataIFaces::rbmcCredentials() const
 {
     return _rbmcCredentials;
 }
+
+void ExternalDataIFaces::onRedundancyPropsChanged(
+    RedundancyPropsChangedHandler handler)
+{
+    _redundancyPropsChangedHandler = std::move(handler);
+}
+
+void ExternalDataIFaces::redundancyPropsChanged() const
+{
+    if (_redundancyPropsChangedHandler)
+    {
+        _redundancyPropsChangedHandler();
+    }
+}
 } // namespace data_sync::ext_data
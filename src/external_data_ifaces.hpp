@@ -5,6 +5,8 @@
 #include <sdbusplus/async.hpp>
 #include <xyz/openbmc_project/State/BMC/Redundancy/common.hpp>
 
+#include <functional>
+
 namespace data_sync::ext_data
 {
 
@@ -15,6 +17,7 @@ using SiblingBmcIP = std::string;
 using RbmcUserName = std::string;
 using RbmcPassword = std::string;
 using RbmcCredentials = std::pair<RbmcUserName, RbmcPassword>;
+using RedundancyPropsChangedHandler = std::function<void()>;
 
 /**
  * @class ExternalDataIFaces
@@ -71,6 +74,14 @@ class ExternalDataIFaces
      */
     const RbmcCredentials& rbmcCredentials() const;
 
+    /**
+     * @brief Used to register the handler which is called once the BMC role
+     *        or the BMC redundancy flag is changed at runtime.
+     *
+     * @param[in] handler - The handler to call
+     */
+    void onRedundancyPropsChanged(RedundancyPropsChangedHandler handler);
+
   protected:
     /**
      * @brief Used to retrieve the BMC role.
@@ -124,6 +135,14 @@ class ExternalDataIFaces
      */
     void rbmcCredentials(const RbmcCredentials& rbmcCredentials);
 
+    /**
+     * @brief A utility API to notify the BMC role or the BMC redundancy flag
+     *        is changed at runtime.
+     *
+     * @return None.
+     */
+    void redundancyPropsChanged() const;
+
   private:
     /**
      * @brief Holds the BMC role.
@@ -144,6 +163,12 @@ class ExternalDataIFaces
      * @brief This is Pair, hold the BMCs Username and Password
      */
     RbmcCredentials _rbmcCredentials;
+
+    /**
+     * @brief The handler to call once the BMC role or the BMC redundancy
+     *        flag is changed.
+     */
+    RedundancyPropsChangedHandler _redundancyPropsChangedHandler;
 };
 
 } // namespace data_sync::ext_data
@@ -19,6 +19,13 @@ sdbusplus::async::task<> ExternalDataIFacesImpl::fetchBMCRedundancyMgrProps()
     //      heavily on these DBus properties and cannot function effectively
     //      without them.
     //      Create error log?
+
+    // Watch the changes before fetching the properties to not miss the
+    // changes in between.
+    _redundancyMgrPropsMatch = std::make_unique<sdbusplus::async::match>(
+        _ctx, sdbusplus::bus::match::rules::propertiesChanged(
+                  RBMC::instance_path, RBMC::interface));
+
     auto rbmcMgr = sdbusplus::async::proxy()
                        .service(RBMC::interface)
                        .path(RBMC::instance_path)
@@ -39,6 +46,40 @@ sdbusplus::async::task<> ExternalDataIFacesImpl::fetchBMCRedundancyMgrProps()
         bmcRedundancy(std::get<BMCRedundancy>(it->second));
     }
 
+    _ctx.spawn(watchBMCRedundancyMgrProps());
+
+    co_return;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> ExternalDataIFacesImpl::watchBMCRedundancyMgrProps()
+{
+    while (!_ctx.stop_requested())
+    {
+        auto [interface, props] = co_await _redundancyMgrPropsMatch->next<
+            std::string, std::map<std::string, RBMC::PropertiesVariant>>();
+
+        bool changed = false;
+        auto it = props.find("Role");
+        if (it != props.end())
+        {
+            bmcRole(std::get<BMCRole>(it->second));
+            changed = true;
+        }
+
+        it = props.find("RedundancyEnabled");
+        if (it != props.end())
+        {
+            bmcRedundancy(std::get<BMCRedundancy>(it->second));
+            changed = true;
+        }
+
+        if (changed)
+        {
+            redundancyPropsChanged();
+        }
+    }
+
     co_return;
 }
 
@@ -6,6 +6,8 @@
 
 #include <sdbusplus/async.hpp>
 
+#include <memory>
+
 namespace data_sync::ext_data
 {
 
@@ -38,6 +40,12 @@ class ExternalDataIFacesImpl : public ExternalDataIFaces
      */
     sdbusplus::async::task<> fetchBMCRedundancyMgrProps() override;
 
+    /**
+     * @brief Used to watch the BMC role and the BMC redundancy flag changes
+     *        and notify them.
+     */
+    sdbusplus::async::task<> watchBMCRedundancyMgrProps();
+
     /**
      * @brief Used to retrieve the Sibling BMC IP from Dbus.
      */
@@ -52,6 +60,11 @@ class ExternalDataIFacesImpl : public ExternalDataIFaces
      * @brief Used to get the async context
      */
     sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief The match of the BMC redundancy manager properties changes.
+     */
+    std::unique_ptr<sdbusplus::async::match> _redundancyMgrPropsMatch;
 };
 
 } // namespace data_sync::ext_data
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fd.hpp"
+
+#include <unistd.h>
+
+namespace data_sync
+{
+
+FD::~FD()
+{
+    if (_fd >= 0)
+    {
+        close(_fd);
+    }
+}
+
+} // namespace data_sync
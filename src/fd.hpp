@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+namespace data_sync
+{
+
+/**
+ * @class FD
+ *
+ * @brief RAII wrapper for a file descriptor like an inotify instance, an
+ *        eventfd or a pipe end.
+ */
+class FD
+{
+  public:
+    FD() = delete;
+    FD(const FD&) = delete;
+    FD& operator=(const FD&) = delete;
+    FD(FD&&) = delete;
+    FD& operator=(FD&&) = delete;
+
+    /**
+     * @brief The constructor
+     *
+     * @param[in] fd - The file descriptor to manage
+     */
+    explicit FD(int fd) : _fd(fd) {}
+
+    /**
+     * @brief The destructor closes the file descriptor if it is valid.
+     */
+    ~FD();
+
+    /**
+     * @brief Get the managed file descriptor.
+     */
+    int operator()() const
+    {
+        return _fd;
+    }
+
+  private:
+    /**
+     * @brief The file descriptor
+     */
+    int _fd = -1;
+};
+
+} // namespace data_sync
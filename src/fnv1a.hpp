@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace data_sync
+{
+
+/**
+ * @brief Compute the FNV-1a hash of the given data.
+ *
+ *        It is used to detect the corrupted persisted data, hence it is not
+ *        a cryptographic hash.
+ *
+ * @param[in] data - The data to hash
+ * @param[in] hash - The hash of the preceding data to continue with
+ *
+ * @return The hash
+ */
+constexpr std::uint64_t fnv1a(std::string_view data,
+                              std::uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    for (auto byte : data)
+    {
+        hash ^= static_cast<std::uint8_t>(byte);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+} // namespace data_sync
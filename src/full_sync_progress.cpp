@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "full_sync_progress.hpp"
+
+namespace data_sync
+{
+
+void FullSyncProgressTracker::start(std::size_t totalCount, bool resumed,
+                                    Clock::time_point now)
+{
+    _progress = {};
+    _progress._totalCount = totalCount;
+    _progress._resumed = resumed;
+    _emitted = _progress;
+    _startTime = now;
+    _emitTime = now;
+    _skippedCount = 0;
+    _emitCount = 0;
+}
+
+const FullSyncProgress& FullSyncProgressTracker::emit(Clock::time_point now)
+{
+    auto throughput = _emitted._throughput;
+    auto elapsed = std::chrono::duration<double>(now - _emitTime).count();
+    if (elapsed > 0)
+    {
+        auto currentThroughput = static_cast<std::uint64_t>(
+            static_cast<double>(_progress._transferredBytes -
+                                _emitted._transferredBytes) /
+            elapsed);
+
+        // Smooth the throughput with the previous emissions once the data
+        // is started transferring.
+        throughput = throughput == 0 ? currentThroughput
+                                     : (throughput + currentThroughput) / 2;
+    }
+
+    _emitted = _progress;
+    _emitted._throughput = throughput;
+
+    // The paths skipped while resuming are synced in no time, hence they
+    // are not counted to estimate.
+    auto timedCount = _progress._syncedCount - _skippedCount;
+    if (timedCount > 0)
+    {
+        auto remainingCount = _progress._totalCount - _progress._syncedCount;
+        _emitted._eta = std::chrono::duration_cast<std::chrono::seconds>(
+            (now - _startTime) * remainingCount / timedCount);
+    }
+
+    _emitTime = now;
+    ++_emitCount;
+    return _emitted;
+}
+
+} // namespace data_sync
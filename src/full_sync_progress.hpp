@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace data_sync
+{
+
+/**
+ * @brief The structure contains the progress of the full sync.
+ */
+struct FullSyncProgress
+{
+    /**
+     * @brief The number of the configured paths which are synced.
+     */
+    std::size_t _syncedCount{0};
+
+    /**
+     * @brief The number of the configured paths to sync.
+     */
+    std::size_t _totalCount{0};
+
+    /**
+     * @brief The number of the bytes transferred since the full sync is
+     *        started.
+     */
+    std::uint64_t _transferredBytes{0};
+
+    /**
+     * @brief The current throughput in bytes per second.
+     */
+    std::uint64_t _throughput{0};
+
+    /**
+     * @brief The estimated time to complete the full sync, unset until
+     *        a path is synced.
+     */
+    std::optional<std::chrono::seconds> _eta;
+
+    /**
+     * @brief Whether the full sync is resumed from the checkpoint.
+     */
+    bool _resumed{false};
+};
+
+/**
+ * @class FullSyncProgressTracker
+ *
+ * @brief The class tracks the progress of the full sync and coalesces the
+ *        updates into the emitted progress at a bounded rate, so that the
+ *        progress doesn't flood the bus while syncing many paths.
+ *
+ *        - The throughput is smoothed over the emissions as the data is
+ *          transferred in bursts of a path at a time.
+ *        - The ETA is estimated from the average time taken to sync a path
+ *          in this run, the paths skipped while resuming are not counted.
+ */
+class FullSyncProgressTracker
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The constructor of the tracker.
+     *
+     * @param[in] emitInterval - The minimum interval between the emissions
+     */
+    explicit FullSyncProgressTracker(Clock::duration emitInterval) :
+        _emitInterval(emitInterval)
+    {}
+
+    /**
+     * @brief Start tracking a new full sync.
+     *
+     * @param[in] totalCount - The number of the configured paths to sync
+     * @param[in] resumed - Whether it is resumed from the checkpoint
+     * @param[in] now - The current time
+     */
+    void start(std::size_t totalCount, bool resumed, Clock::time_point now);
+
+    /**
+     * @brief Count a configured path as synced since it is not
+     *        changed since the interrupted full sync.
+     */
+    void skipped()
+    {
+        ++_progress._syncedCount;
+        ++_skippedCount;
+    }
+
+    /**
+     * @brief Count a configured path as synced.
+     */
+    void synced()
+    {
+        ++_progress._syncedCount;
+    }
+
+    /**
+     * @brief Account the given bytes as transferred.
+     *
+     * @param[in] bytes - The number of the transferred bytes
+     */
+    void transferred(std::uint64_t bytes)
+    {
+        _progress._transferredBytes += bytes;
+    }
+
+    /**
+     * @brief Get the tracked number of the synced paths.
+     */
+    std::size_t syncedCount() const
+    {
+        return _progress._syncedCount;
+    }
+
+    /**
+     * @brief Get the time from which the next emission is allowed.
+     */
+    Clock::time_point nextEmitTime() const
+    {
+        return _emitTime + _emitInterval;
+    }
+
+    /**
+     * @brief Emit the tracked progress.
+     *
+     * @param[in] now - The current time
+     *
+     * @return The emitted progress.
+     */
+    const FullSyncProgress& emit(Clock::time_point now);
+
+    /**
+     * @brief Get the last emitted progress.
+     */
+    const FullSyncProgress& emitted() const
+    {
+        return _emitted;
+    }
+
+    /**
+     * @brief Get the number of the emissions since the full sync is
+     *        started.
+     */
+    std::size_t emitCount() const
+    {
+        return _emitCount;
+    }
+
+  private:
+    /**
+     * @brief The minimum interval between the emissions.
+     */
+    Clock::duration _emitInterval;
+
+    /**
+     * @brief The tracked progress which is not emitted yet.
+     */
+    FullSyncProgress _progress;
+
+    /**
+     * @brief The last emitted progress.
+     */
+    FullSyncProgress _emitted;
+
+    /**
+     * @brief The time when the full sync is started.
+     */
+    Clock::time_point _startTime;
+
+    /**
+     * @brief The time of the last emission.
+     */
+    Clock::time_point _emitTime;
+
+    /**
+     * @brief The number of the paths skipped while resuming.
+     */
+    std::size_t _skippedCount{0};
+
+    /**
+     * @brief The number of the emissions since the full sync is started.
+     */
+    std::size_t _emitCount{0};
+};
+
+} // namespace data_sync
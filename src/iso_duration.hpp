@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace data_sync::config
+{
+
+/**
+ * @brief Parse the time duration in ISO 8601 duration format.
+ *
+ *        The supported formats are "PnW" and "PnDTnHnMnS" where every
+ *        component is optional but at least one must be present, e.g.
+ *        "P2W", "P1DT12H", "PT1M10S", "PT0.5S".
+ *
+ *        - The last component may have a fraction with either '.' or ','
+ *          as the decimal sign, e.g. "PT1.5H".
+ *        - The years and months are not supported as their length in
+ *          seconds is not fixed.
+ *        - The parser doesn't allocate or throw, and it can be used at
+ *          compile time.
+ *
+ * @param[in] duration - The time duration in ISO 8601 duration format
+ *
+ * @return The time duration in milliseconds on success; otherwise, nullopt
+ *         if the format is invalid, not supported or the duration overflows.
+ */
+constexpr std::optional<std::chrono::milliseconds>
+    parseISODuration(std::string_view duration) noexcept
+{
+    constexpr uint64_t msPerSec = 1000;
+    constexpr uint64_t msPerMin = 60 * msPerSec;
+    constexpr uint64_t msPerHour = 60 * msPerMin;
+    constexpr uint64_t msPerDay = 24 * msPerHour;
+    constexpr uint64_t msPerWeek = 7 * msPerDay;
+    constexpr uint64_t maxMs = std::numeric_limits<int64_t>::max();
+    // The fraction digits beyond the nanoseconds are ignored.
+    constexpr std::size_t maxFractionDigits = 9;
+
+    if (duration.size() < 3 || duration.front() != 'P')
+    {
+        return std::nullopt;
+    }
+
+    // The units in the order they are allowed to appear, the units before
+    // 'T' are the date units and the rest are the time units.
+    struct Unit
+    {
+        char _designator;
+        bool _isTime;
+        uint64_t _ms;
+    };
+    constexpr Unit units[] = {{'W', false, msPerWeek}, {'D', false, msPerDay},
+                              {'H', true, msPerHour},  {'M', true, msPerMin},
+                              {'S', true, msPerSec}};
+
+    uint64_t totalMs = 0;
+    std::size_t nextUnit = 0;
+    bool inTime = false;
+    bool hasFraction = false;
+    bool hasTimeComponent = false;
+    std::size_t pos = 1;
+
+    while (pos < duration.size())
+    {
+        if (duration[pos] == 'T')
+        {
+            if (inTime)
+            {
+                return std::nullopt;
+            }
+            inTime = true;
+            ++pos;
+            continue;
+        }
+
+        // Only the last component can have a fraction.
+        if (hasFraction)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t value = 0;
+        std::size_t digits = 0;
+        for (; pos < duration.size() && duration[pos] >= '0' &&
+               duration[pos] <= '9';
+             ++pos, ++digits)
+        {
+            auto digit = static_cast<uint64_t>(duration[pos] - '0');
+            if (value > (maxMs - digit) / 10)
+            {
+                return std::nullopt;
+            }
+            value = (value * 10) + digit;
+        }
+        if (digits == 0)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t fraction = 0;
+        uint64_t fractionScale = 1;
+        if (pos < duration.size() &&
+            (duration[pos] == '.' || duration[pos] == ','))
+        {
+            hasFraction = true;
+            std::size_t fractionDigits = 0;
+            for (++pos; pos < duration.size() && duration[pos] >= '0' &&
+                        duration[pos] <= '9';
+                 ++pos, ++fractionDigits)
+            {
+                if (fractionDigits < maxFractionDigits)
+                {
+                    fraction = (fraction * 10) +
+                               static_cast<uint64_t>(duration[pos] - '0');
+                    fractionScale *= 10;
+                }
+            }
+            if (fractionDigits == 0)
+            {
+                return std::nullopt;
+            }
+        }
+
+        if (pos == duration.size())
+        {
+            return std::nullopt;
+        }
+
+        // The units must be in order without repeating and within the
+        // corresponding date or time part.
+        auto designator = duration[pos++];
+        while (nextUnit < std::size(units) &&
+               (units[nextUnit]._designator != designator ||
+                units[nextUnit]._isTime != inTime))
+        {
+            ++nextUnit;
+        }
+        if (nextUnit == std::size(units))
+        {
+            return std::nullopt;
+        }
+        const auto& unit = units[nextUnit++];
+
+        // The week format can't be combined with the other units.
+        if (unit._designator == 'W')
+        {
+            nextUnit = std::size(units);
+        }
+        hasTimeComponent = hasTimeComponent || unit._isTime;
+
+        if (value > maxMs / unit._ms)
+        {
+            return std::nullopt;
+        }
+        auto componentMs = (value * unit._ms) +
+                           ((fraction * unit._ms) / fractionScale);
+        if (componentMs > maxMs - totalMs)
+        {
+            return std::nullopt;
+        }
+        totalMs += componentMs;
+    }
+
+    // The time designator must be followed by a time component.
+    if (inTime && !hasTimeComponent)
+    {
+        return std::nullopt;
+    }
+
+    return std::chrono::milliseconds(static_cast<int64_t>(totalMs));
+}
+
+} // namespace data_sync::config
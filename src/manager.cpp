@@ -1,239 +1,2174 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "config.h"
+
 #include "manager.hpp"
 
-#include <nlohmann/json.hpp>
+#include "builtin_config.hpp"
+#include "config_cache.hpp"
+#include "config_loader.hpp"
+#include "config_planner.hpp"
+#include "data_watcher.hpp"
+#include "fd.hpp"
+#include "fnv1a.hpp"
+#include "worker.hpp"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include <phosphor-logging/lg2.hpp>
 
-#include <cstdlib>
-#include <exception>
-#include <fstream>
-#include <iterator>
-#include <string>
-#include <string_view>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace data_sync
+{
+
+/**
+ * @brief The file name of the config cache in the persist directory.
+ */
+constexpr auto configCacheFileName = "config.cache";
+
+/**
+ * @brief The interval to check whether the unreachable sibling BMC is
+ *        reachable again.
+ */
+constexpr auto siblingProbeInterval = std::chrono::seconds(10);
+
+/**
+ * @brief The file name of the change journal in the persist directory.
+ */
+constexpr auto changeJournalFileName = "change.journal";
+
+/**
+ * @brief The interval to group the journaled changes into a single commit.
+ */
+constexpr auto journalCommitInterval = std::chrono::milliseconds(100);
+
+/**
+ * @brief The minimum interval between the progress emissions of the full
+ *        sync.
+ */
+constexpr auto fullSyncProgressInterval = std::chrono::seconds(1);
+
+/**
+ * @brief The maximum number of the concurrent transfers of the full sync.
+ */
+constexpr std::size_t maxFullSyncTransfers = 4;
+
+/**
+ * @brief The maximum number of the concurrent syncs of the changed data.
+ */
+constexpr std::size_t maxSyncTransfers = 4;
+
+/**
+ * @brief The default latency to sync the changed data of the immediate sync.
+ */
+constexpr auto defaultImmediateSyncLatency = std::chrono::seconds(1);
+
+/**
+ * @brief The default burst of the sync traffic allowed by the rate limits,
+ *        in terms of the time worth of the rate.
+ */
+constexpr auto defaultRateLimitBurst = std::chrono::seconds(2);
+
+/**
+ * @brief The maximum time to wait for the rate limits before checking them
+ *        again, to follow the limits which are adjusted while waiting.
+ */
+constexpr auto rateLimitRecheckInterval = std::chrono::milliseconds(100);
+
+/**
+ * @brief The time before the deadline from which the queued sync is run at
+ *        the raised priority.
+ */
+constexpr auto urgentSyncMargin = std::chrono::milliseconds(500);
+
+/**
+ * @brief The exit code of the transfer process if the transfer command is
+ *        failed to execute, as the shell does.
+ */
+constexpr int transferExecFailure = 127;
+
+/**
+ * @brief The size from which a file is transferred as a large file, which
+ *        is resumable from the interrupted transfer.
+ */
+constexpr std::uintmax_t largeFileSize = 64 * 1024 * 1024;
+
+/**
+ * @brief The size of the blocks verified by the transfer of a large file,
+ *        the largest one the rsync accepts.
+ */
+constexpr std::size_t largeFileBlockSize = 128 * 1024;
+
+/**
+ * @brief The directory, relative to the destination, to keep the
+ *        interrupted transfers of the large files.
+ */
+constexpr auto largeFilePartialDir = ".data-sync-partial";
+
+/**
+ * @brief The name template of the directories, next to the destination, to
+ *        stage the basis of the transfers.
+ */
+constexpr auto basisDirTemplate = ".data-sync-basis-XXXXXX";
+
+namespace
+{
+
+/**
+ * @brief Get the priority of the transfers from the build time
+ *        configuration, and create the cgroup of them if configured.
+ *
+ * @return The priority of the transfers.
+ */
+transfer::Priority makeTransferPriority()
+{
+    transfer::Priority priority;
+    priority._nice = TRANSFER_NICE;
+    priority._ioClass = static_cast<transfer::IOClass>(TRANSFER_IONICE_CLASS);
+    priority._ioLevel = TRANSFER_IONICE_LEVEL;
+    priority._cpuAffinity = transfer::parseCpuList(TRANSFER_CPU_AFFINITY);
+
+    constexpr std::string_view cpuAffinity{TRANSFER_CPU_AFFINITY};
+    if (!cpuAffinity.empty() && !priority._cpuAffinity.has_value())
+    {
+        lg2::error("Invalid CPU affinity [{CPU_LIST}] of the transfers, "
+                   "running them on any CPU",
+                   "CPU_LIST", cpuAffinity);
+    }
+
+    constexpr std::string_view cgroup{TRANSFER_CGROUP};
+    if (!cgroup.empty())
+    {
+        priority._cgroupProcs = transfer::setupCgroup(
+            cgroup, TRANSFER_CPU_WEIGHT, TRANSFER_IO_WEIGHT);
+    }
+    return priority;
+}
+
+/**
+ * @brief Find the executable of the given command in the PATH, as the
+ *        forked transfer process can't search it safely.
+ *
+ * @param[in] command - The command name or path
+ *
+ * @return The path of the executable, the command itself if it is a path
+ *         or not found.
+ */
+std::string findExecutable(const std::string& command)
+{
+    const auto* pathEnv = std::getenv("PATH");
+    if (command.contains('/') || pathEnv == nullptr)
+    {
+        return command;
+    }
+
+    for (auto dir : std::views::split(std::string_view{pathEnv}, ':'))
+    {
+        // The empty entry is the current directory.
+        std::string_view dirPath{dir.begin(), dir.end()};
+        auto executable =
+            (dirPath.empty() ? fs::path(".") : fs::path(dirPath)) / command;
+        if (access(executable.c_str(), X_OK) == 0)
+        {
+            return executable.string();
+        }
+    }
+    return command;
+}
+
+/**
+ * @brief Get the number of the given statistic of the rsync.
+ *
+ * @param[in] stats - The output of the rsync with the statistics
+ * @param[in] name - The name of the statistic followed by the separator
+ *
+ * @return The number, nullopt if not found.
+ */
+std::optional<std::uint64_t> parseStatsNumber(std::string_view stats,
+                                              std::string_view name)
+{
+    auto pos = stats.find(name);
+    if (pos == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+
+    // The newer rsync groups the digits by the comma.
+    std::uint64_t number = 0;
+    for (auto digit : stats.substr(pos + name.size()))
+    {
+        if (digit >= '0' && digit <= '9')
+        {
+            number = (number * 10) + static_cast<std::uint64_t>(digit - '0');
+        }
+        else if (digit != ',')
+        {
+            break;
+        }
+    }
+    return number;
+}
+
+/**
+ * @brief Check whether the given path is the given parent path or under it.
+ *
+ * @param[in] path - The path to check
+ * @param[in] parentPath - The parent path
+ *
+ * @return True if under the parent path; otherwise False.
+ */
+bool isPathUnder(std::string_view path, std::string_view parentPath)
+{
+    return path.starts_with(parentPath) &&
+           (path.size() == parentPath.size() || parentPath.ends_with('/') ||
+            path[parentPath.size()] == '/');
+}
+
+/**
+ * @brief Check whether the given path is in the directory which keeps the
+ *        interrupted transfers of the large files.
+ *
+ * @param[in] path - The path to check
+ *
+ * @return True if in the directory; otherwise False.
+ */
+bool isKeptTransfer(const fs::path& path)
+{
+    return std::ranges::contains(path, fs::path(largeFilePartialDir));
+}
+
+/**
+ * @class BasisDir
+ *
+ * @brief The directory which stages the basis of a transfer under the name
+ *        of the destination, for the rsync to take it as the basis by the
+ *        --copy-dest option. The directory is removed once destroyed.
+ */
+class BasisDir
+{
+  public:
+    BasisDir(const BasisDir&) = delete;
+    BasisDir& operator=(const BasisDir&) = delete;
+
+    BasisDir(BasisDir&& other) noexcept :
+        _path(std::exchange(other._path, {}))
+    {}
+
+    BasisDir& operator=(BasisDir&& other) noexcept
+    {
+        std::swap(_path, other._path);
+        return *this;
+    }
+
+    ~BasisDir()
+    {
+        if (!_path.empty())
+        {
+            std::error_code ec;
+            fs::remove_all(_path, ec);
+        }
+    }
+
+    /**
+     * @brief Stage the given basis for the transfer to the given destination.
+     *
+     * @param[in] basis - The path of the basis
+     * @param[in] destPath - The destination path of the transfer
+     *
+     * @return The staged basis directory, nullopt if failed to stage.
+     *
+     * @note The basis is linked rather than copied, hence it is staged only
+     *       if it is on the same file system as the destination.
+     */
+    static std::optional<BasisDir> stage(const fs::path& basis,
+                                         const fs::path& destPath)
+    {
+        auto dirPath = (destPath.parent_path() / basisDirTemplate).string();
+        if (mkdtemp(dirPath.data()) == nullptr)
+        {
+            return std::nullopt;
+        }
+        BasisDir basisDir{dirPath};
+
+        std::error_code ec;
+        fs::create_hard_link(basis, basisDir._path / destPath.filename(), ec);
+        if (ec)
+        {
+            lg2::debug("Failed to stage the basis {BASIS} for {PATH}, "
+                       "error: {ERROR}",
+                       "BASIS", basis.string(), "PATH", destPath.string(),
+                       "ERROR", ec.message());
+            return std::nullopt;
+        }
+        return basisDir;
+    }
+
+    /**
+     * @brief Get the path of the directory.
+     */
+    const fs::path& path() const
+    {
+        return _path;
+    }
+
+  private:
+    explicit BasisDir(fs::path path) : _path(std::move(path)) {}
+
+    /**
+     * @brief The path of the directory.
+     */
+    fs::path _path;
+};
+
+} // namespace
+
+Manager::Manager(sdbusplus::async::context& ctx,
+                 std::unique_ptr<ext_data::ExternalDataIFaces>&& extDataIfaces,
+                 const fs::path& dataSyncCfgDir,
+                 const fs::path& dataSyncPersistDir) :
+    _ctx(ctx), _extDataIfaces(std::move(extDataIfaces)),
+    _dataSyncCfgDir(dataSyncCfgDir), _dataSyncPersistDir(dataSyncPersistDir),
+    _changeLog(OFFLINE_QUEUE_SIZE),
+    _changeJournal(dataSyncPersistDir / changeJournalFileName),
+    _fullSyncProgress(fullSyncProgressInterval),
+    _syncScheduler(maxSyncTransfers),
+    _byteRateLimit(SYNC_BANDWIDTH_LIMIT * 1024,
+                   SYNC_BANDWIDTH_LIMIT * 1024 * defaultRateLimitBurst.count(),
+                   TokenBucket::Clock::now()),
+    _fileRateLimit(SYNC_FILE_RATE_LIMIT,
+                   SYNC_FILE_RATE_LIMIT * defaultRateLimitBurst.count(),
+                   TokenBucket::Clock::now()),
+    _transferPriority(makeTransferPriority()),
+    _compressionPolicy(
+        static_cast<CompressionPolicy::Algorithm>(TRANSFER_COMPRESS_CHOICE)),
+    _syncBMCDataIface(ctx, *this), _fullSyncIface(ctx, *this),
+    _rateLimitIface(ctx, *this, SYNC_BANDWIDTH_LIMIT, SYNC_FILE_RATE_LIMIT,
+                    defaultRateLimitBurst),
+    _statisticsIface(ctx)
+{
+    // The urgent transfers are not deprioritized but kept off the CPUs of
+    // the other services.
+    _urgentTransferPriority._cpuAffinity = _transferPriority._cpuAffinity;
+
+    _extDataIfaces->onRedundancyPropsChanged([this]() { switchSyncEvents(); });
+    _ctx.spawn(init());
+}
+
+Manager::~Manager()
+{
+    // The data changed after this is synced once the daemon is started again
+    // without the full sync. The fingerprints are kept as the data is synced
+    // to not walk the data here, the data changed after its fingerprint is
+    // either journaled as the pending change or found changed.
+    _changeJournal.logShutdown(_sourceFingerprints);
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::init()
+{
+    auto initStartTime = std::chrono::steady_clock::now();
+
+    // Restore the pending changes of the previous run and start a new
+    // journal of this run.
+    auto journalIntact = _changeJournal.load(_changeLog);
+    _changeJournal.compact(_changeLog);
+
+    co_await sdbusplus::async::execution::when_all(
+        parseConfiguration(), _extDataIfaces->startExtDataFetches());
+
+    // TODO: Explore the possibility of running FullSync and Background Sync
+    // concurrently
+    _syncRedundancy = _extDataIfaces->bmcRedundancy();
+    if (*_syncRedundancy)
+    {
+        // The pending changes of the previous run and the data changed while
+        // the daemon is down are all the changes to sync if the daemon is
+        // restarted gracefully after the full sync of the same
+        // configuration, otherwise the full sync syncs them as well.
+        auto changesKnown =
+            journalIntact &&
+            _changeJournal.fullSyncFingerprint() == configFingerprint() &&
+            co_await recordOfflineChanges() && !_changeLog.overflowed();
+        if (changesKnown)
+        {
+            auto syncedCount = co_await syncPendingChanges();
+            lg2::info("Skipping the full sync as the {COUNT} pending changes "
+                      "are replayed from the journal",
+                      "COUNT", syncedCount);
+        }
+        else
+        {
+            co_await startFullSync();
+        }
+    }
+
+    co_await startSyncEvents();
+
+    lg2::info("Data sync is ready in {DURATION_MS} ms", "DURATION_MS",
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - initStartTime)
+                  .count());
+    co_return;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::parseConfiguration()
+{
+    auto parseStartTime = std::chrono::steady_clock::now();
+
+    // The cache is loaded on a worker as well to not block the event loop,
+    // like the bus name request, by the size of the configuration.
+    auto [sourceFiles, cachedCfgs] = co_await runInWorker(_ctx, [this]() {
+        auto sourceFiles =
+            config::ConfigCache::getSourceFiles(_dataSyncCfgDir);
+        auto cachedCfgs =
+            config::ConfigCache{_dataSyncPersistDir / configCacheFileName}
+                .load(sourceFiles);
+        return std::make_pair(std::move(sourceFiles), std::move(cachedCfgs));
+    });
+
+    if (cachedCfgs.has_value())
+    {
+        for (std::size_t index = 0; index < sourceFiles.size(); ++index)
+        {
+            _configFiles.insert_or_assign(
+                sourceFiles[index]._path,
+                ConfigFile{sourceFiles[index], std::move((*cachedCfgs)[index])});
+        }
+    }
+    else
+    {
+        std::vector<std::string> configFiles;
+        configFiles.reserve(sourceFiles.size());
+        std::ranges::transform(sourceFiles, std::back_inserter(configFiles),
+                               &config::SourceFile::_path);
+
+        // Parse the files on the worker threads to not block the event loop.
+        config::ConfigLoader configLoader{_ctx, std::move(configFiles)};
+        auto parsedCfgs = co_await configLoader.load();
+
+        for (std::size_t index = 0; index < sourceFiles.size(); ++index)
+        {
+            if (parsedCfgs[index].has_value())
+            {
+                _configFiles.insert_or_assign(
+                    sourceFiles[index]._path,
+                    ConfigFile{sourceFiles[index],
+                               std::move(*parsedCfgs[index])});
+            }
+            else
+            {
+                _unparsedConfigFiles.insert(sourceFiles[index]._path);
+            }
+        }
+        storeConfigCache();
+    }
+
+    _dataSyncConfiguration = config::ConfigStore(buildConfiguration());
+    _syncPlan.reset();
+
+    lg2::info("Loaded {COUNT} data sync configurations in {DURATION_MS} ms",
+              "COUNT", _dataSyncConfiguration.size(), "DURATION_MS",
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - parseStartTime)
+                  .count());
+
+    co_return;
+}
+
+std::vector<config::DataSyncConfig> Manager::buildConfiguration()
+{
+    std::vector<config::DataSyncConfig> dataSyncCfgs;
+    for (const auto& configFile : _configFiles | std::views::values)
+    {
+        dataSyncCfgs.insert(dataSyncCfgs.end(),
+                            configFile._dataSyncCfgs.begin(),
+                            configFile._dataSyncCfgs.end());
+    }
+
+    // The configuration directory overrides the builtin configurations.
+    config::mergeBuiltinConfigs(config::getBuiltinConfigs(), dataSyncCfgs);
+
+    expandPathTemplates(dataSyncCfgs);
+
+    // Plan the non overlapping configurations as multiple configuration files
+    // may list the same data.
+    return config::ConfigPlanner(std::move(dataSyncCfgs)).plan();
+}
+
+void Manager::expandPathTemplates(
+    std::vector<config::DataSyncConfig>& dataSyncCfgs)
+{
+    auto templateCfgs = std::ranges::stable_partition(
+        dataSyncCfgs, [](const auto& dataSyncCfg) {
+        return !config::PathTemplate::isTemplate(dataSyncCfg._path);
+    });
+
+    // Stop monitoring the path templates which are no longer configured.
+    std::erase_if(_pathTemplates, [&templateCfgs](auto& pathTemplate) {
+        if (std::ranges::contains(templateCfgs,
+                                  pathTemplate._pathTemplate->templateCfg()))
+        {
+            return false;
+        }
+        pathTemplate._stopSource.request_stop();
+        return true;
+    });
+
+    std::vector<config::DataSyncConfig> instanceCfgs;
+    for (const auto& templateCfg : templateCfgs)
+    {
+        auto pathTemplate = std::ranges::find_if(
+            _pathTemplates, [&templateCfg](const auto& pathTemplate) {
+            return pathTemplate._pathTemplate->templateCfg() == templateCfg;
+        });
+
+        // Keep the already found instances of the unchanged path template.
+        if (pathTemplate != _pathTemplates.end())
+        {
+            std::ranges::move(pathTemplate->_pathTemplate->instances(),
+                              std::back_inserter(instanceCfgs));
+            continue;
+        }
+
+        try
+        {
+            auto& newTemplate = _pathTemplates.emplace_back(
+                std::make_shared<config::PathTemplate>(templateCfg));
+            std::ranges::move(
+                HOST_INSTANCES > 0
+                    ? newTemplate._pathTemplate->expand(HOST_INSTANCES)
+                    : newTemplate._pathTemplate->expand(),
+                std::back_inserter(instanceCfgs));
+        }
+        catch (const std::invalid_argument& e)
+        {
+            lg2::error("Ignoring the path template : {PATH}, exception : "
+                       "{EXCEPTION}",
+                       "PATH", templateCfg._path, "EXCEPTION", e);
+        }
+    }
+    dataSyncCfgs.erase(templateCfgs.begin(), templateCfgs.end());
+    std::ranges::move(instanceCfgs, std::back_inserter(dataSyncCfgs));
+}
+
+void Manager::storeConfigCache() const
+{
+    // Don't cache the partially parsed configuration to report
+    // the parsing failures on every start.
+    if (!_unparsedConfigFiles.empty())
+    {
+        return;
+    }
+
+    // The details of the files are taken before parsing them so that the
+    // cache is invalidated if a file is changed while it is parsed.
+    std::vector<config::SourceFile> sourceFiles;
+    std::vector<std::vector<config::DataSyncConfig>> dataSyncCfgs;
+    for (const auto& configFile : _configFiles | std::views::values)
+    {
+        sourceFiles.push_back(configFile._sourceFile);
+        dataSyncCfgs.push_back(configFile._dataSyncCfgs);
+    }
+
+    config::ConfigCache{_dataSyncPersistDir / configCacheFileName}.store(
+        sourceFiles, dataSyncCfgs);
+}
+
+bool Manager::isSyncEligible(const config::DataSyncConfig& dataSyncCfg)
+{
+    return SyncPlan::isEligible(dataSyncCfg._syncDirection,
+                                _extDataIfaces->bmcRole());
+}
+
+const SyncPlan& Manager::syncPlan()
+{
+    auto bmcRole = _extDataIfaces->bmcRole();
+    if (!_syncPlan.has_value() || _syncPlan->bmcRole() != bmcRole)
+    {
+        _syncPlan.emplace(_dataSyncConfiguration, bmcRole);
+        lg2::debug("Planned {COUNT} of {TOTAL} data sync configurations for "
+                   "the BMC role: {BMC_ROLE}",
+                   "COUNT", _syncPlan->size(), "TOTAL",
+                   _dataSyncConfiguration.size(), "BMC_ROLE", bmcRole);
+    }
+    return *_syncPlan;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::startSyncEvents()
+{
+    const auto& plan = syncPlan();
+    for (auto syncType :
+         {config::SyncType::Immediate, config::SyncType::Periodic})
+    {
+        for (auto index : plan.cfgs(syncType))
+        {
+            startSyncEvent(_dataSyncConfiguration[index]);
+        }
+    }
+    _syncEventsRole = plan.bmcRole();
+
+    startPathTemplateMonitors();
+
+    _ctx.spawn(monitorConfigDir());
+    co_return;
+}
+
+void Manager::startSyncEvent(const config::DataSyncConfig& dataSyncCfg)
+{
+    using enum config::SyncType;
+    const auto& stopSource =
+        _syncEvents.emplace_back(dataSyncCfg, std::stop_source{}).second;
+    if (dataSyncCfg._syncType == Immediate)
+    {
+        _ctx.spawn(monitorDataToSync(dataSyncCfg, stopSource.get_token()));
+    }
+    else if (dataSyncCfg._syncType == Periodic)
+    {
+        _ctx.spawn(monitorTimerToSync(dataSyncCfg, stopSource.get_token()));
+    }
+}
+
+void Manager::stopSyncEvent(const config::DataSyncConfig& dataSyncCfg)
+{
+    auto syncEvent = std::ranges::find(_syncEvents, dataSyncCfg,
+                                       &decltype(_syncEvents)::value_type::first);
+    if (syncEvent != _syncEvents.end())
+    {
+        syncEvent->second.request_stop();
+        _syncEvents.erase(syncEvent);
+    }
+}
+
+void Manager::switchSyncEvents()
+{
+    auto bmcRole = _extDataIfaces->bmcRole();
+    auto bmcRedundancy = _extDataIfaces->bmcRedundancy();
+
+    // The full sync in progress syncs the data of the previous role, or to
+    // the sibling which is not redundant anymore.
+    if ((bmcRole != _fullSyncRole || !bmcRedundancy) && cancelFullSync())
+    {
+        lg2::info("Cancelled the full sync as the BMC role or the redundancy "
+                  "is changed");
+    }
+
+    // The initial full sync is decided by the redundancy at that time.
+    auto redundancyEnabled = false;
+    if (_syncRedundancy.has_value())
+    {
+        redundancyEnabled = bmcRedundancy && !*_syncRedundancy;
+        _syncRedundancy = bmcRedundancy;
+    }
+    if (redundancyEnabled)
+    {
+        lg2::info("The BMC redundancy is enabled, starting the full sync");
+        _ctx.spawn(startFullSync());
+    }
+
+    if (_syncEventsRole.has_value() && *_syncEventsRole != bmcRole)
+    {
+        switchSyncRole(bmcRole, redundancyEnabled);
+    }
+}
+
+void Manager::switchSyncRole(ext_data::BMCRole bmcRole, bool fullSyncStarted)
+{
+    auto switchStartTime = std::chrono::steady_clock::now();
+    auto previousRole = std::exchange(*_syncEventsRole, bmcRole);
+
+    // Switch the plan at once, the events are switched without suspending
+    // hence no sync event observes the plan of the previous role.
+    syncPlan();
+
+    std::erase_if(_syncEvents, [bmcRole](auto& syncEvent) {
+        if (SyncPlan::isEligible(syncEvent.first._syncDirection, bmcRole))
+        {
+            return false;
+        }
+        syncEvent.second.request_stop();
+        return true;
+    });
+
+    // Only the directions which are not eligible in the previous role are
+    // looked up as the others are already running.
+    std::vector<config::DataSyncConfig> resyncCfgs;
+    using enum config::SyncDirection;
+    for (auto syncDirection : {Active2Passive, Passive2Active, Bidirectional})
+    {
+        if (!SyncPlan::isEligible(syncDirection, bmcRole) ||
+            SyncPlan::isEligible(syncDirection, previousRole))
+        {
+            continue;
+        }
+        for (auto syncType :
+             {config::SyncType::Immediate, config::SyncType::Periodic})
+        {
+            for (auto index :
+                 _dataSyncConfiguration.findBySyncMode(syncType, syncDirection))
+            {
+                auto dataSyncCfg = _dataSyncConfiguration[index];
+                startSyncEvent(dataSyncCfg);
+                if (_changeLog.needsSync(dataSyncCfg._path))
+                {
+                    resyncCfgs.push_back(std::move(dataSyncCfg));
+                }
+            }
+        }
+    }
+
+    // Sync only the data changed since it is confirmed synced instead of
+    // the full sync.
+    if (_extDataIfaces->bmcRedundancy() && !fullSyncStarted &&
+        !resyncCfgs.empty())
+    {
+        _ctx.spawn(resyncChangedData(std::move(resyncCfgs)));
+    }
+
+    auto roleSwitchLatency =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - switchStartTime);
+    _statisticsIface.role_switch_latency(
+        static_cast<std::uint64_t>(roleSwitchLatency.count()));
+    lg2::info("Switched the data sync from the BMC role {PREVIOUS_ROLE} to "
+              "{BMC_ROLE} in {DURATION_US} us",
+              "PREVIOUS_ROLE", previousRole, "BMC_ROLE", bmcRole,
+              "DURATION_US", roleSwitchLatency.count());
+}
+
+void Manager::startPathTemplateMonitors()
+{
+    // The instances are known upfront if the host instances are configured.
+    if (HOST_INSTANCES != 0)
+    {
+        return;
+    }
+
+    for (auto& pathTemplate : _pathTemplates)
+    {
+        if (!pathTemplate._monitored)
+        {
+            pathTemplate._monitored = true;
+            _ctx.spawn(monitorPathTemplate(
+                pathTemplate._pathTemplate,
+                pathTemplate._stopSource.get_token()));
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::monitorConfigDir()
+{
+    namespace inotify = watch::inotify;
+
+    std::unique_ptr<inotify::DataWatcher> dataWatcher;
+    try
+    {
+        dataWatcher = std::make_unique<inotify::DataWatcher>(
+            _ctx, IN_CLOEXEC,
+            IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE,
+            _dataSyncCfgDir);
+    }
+    catch (const std::system_error& e)
+    {
+        lg2::error("Unable to monitor the configuration directory : {PATH}, "
+                   "exception : {EXCEPTION}",
+                   "PATH", _dataSyncCfgDir, "EXCEPTION", e);
+        co_return;
+    }
+
+    while (!_ctx.stop_requested())
+    {
+        auto events = co_await dataWatcher->onDataChange();
+
+        // Reload the files changed together at once as the editors and
+        // the package managers update the files in multiple steps.
+        std::set<std::string> changedFiles;
+        for (const auto& event : events)
+        {
+            if (!event._name.empty())
+            {
+                changedFiles.insert(
+                    (fs::path(_dataSyncCfgDir) / event._name).string());
+            }
+        }
+
+        if (!changedFiles.empty())
+        {
+            co_await reloadConfiguration(std::move(changedFiles));
+        }
+    }
+    co_return;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::reloadConfiguration(std::set<std::string> changedFiles)
+{
+    auto reloadStartTime = std::chrono::steady_clock::now();
+
+    std::vector<config::SourceFile> sourceFiles;
+    std::vector<std::string> configFiles;
+    for (const auto& changedFile : changedFiles)
+    {
+        auto sourceFile = config::ConfigCache::getSourceFile(changedFile);
+        if (sourceFile.has_value())
+        {
+            configFiles.push_back(changedFile);
+            sourceFiles.emplace_back(std::move(*sourceFile));
+        }
+        else if ((_configFiles.erase(changedFile) +
+                  _unparsedConfigFiles.erase(changedFile)) > 0)
+        {
+            lg2::info("The configuration file {CONFIG_FILE} is removed",
+                      "CONFIG_FILE", changedFile);
+        }
+    }
+
+    config::ConfigLoader configLoader{_ctx, std::move(configFiles)};
+    auto parsedCfgs = co_await configLoader.load();
+
+    for (std::size_t index = 0; index < sourceFiles.size(); ++index)
+    {
+        const auto& cfgFile = sourceFiles[index]._path;
+        if (parsedCfgs[index].has_value())
+        {
+            _configFiles.insert_or_assign(
+                cfgFile, ConfigFile{sourceFiles[index],
+                                    std::move(*parsedCfgs[index])});
+            _unparsedConfigFiles.erase(cfgFile);
+        }
+        else
+        {
+            _unparsedConfigFiles.insert(cfgFile);
+            if (_configFiles.contains(cfgFile))
+            {
+                lg2::error("Keeping the last parsed configuration of "
+                           "{CONFIG_FILE}",
+                           "CONFIG_FILE", cfgFile);
+            }
+        }
+    }
+
+    applyConfiguration(buildConfiguration());
+    startPathTemplateMonitors();
+    storeConfigCache();
+
+    lg2::info("Reloaded the data sync configuration in {DURATION_MS} ms",
+              "DURATION_MS",
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - reloadStartTime)
+                  .count());
+    co_return;
+}
+
+void Manager::applyConfiguration(
+    std::vector<config::DataSyncConfig> dataSyncCfgs)
+{
+    // Match the unchanged configurations by the path index without
+    // comparing all of them.
+    std::vector<bool> unchangedCfgs(_dataSyncConfiguration.size(), false);
+    std::vector<std::size_t> addedCfgs;
+    for (std::size_t index = 0; index < dataSyncCfgs.size(); ++index)
+    {
+        auto currentCfgs =
+            _dataSyncConfiguration.findByPath(dataSyncCfgs[index]._path);
+        auto currentCfg = std::ranges::find_if(
+            currentCfgs, [&](auto currentIndex) {
+            return !unchangedCfgs[currentIndex] &&
+                   _dataSyncConfiguration.matches(currentIndex,
+                                                  dataSyncCfgs[index]);
+        });
+
+        if (currentCfg != currentCfgs.end())
+        {
+            unchangedCfgs[*currentCfg] = true;
+        }
+        else
+        {
+            addedCfgs.push_back(index);
+        }
+    }
+
+    std::vector<config::DataSyncConfig> removedCfgs;
+    for (std::size_t index = 0; index < _dataSyncConfiguration.size(); ++index)
+    {
+        if (!unchangedCfgs[index])
+        {
+            stopSyncEvent(_dataSyncConfiguration[index]);
+            removedCfgs.push_back(_dataSyncConfiguration[index]);
+        }
+    }
+
+    for (auto index : addedCfgs)
+    {
+        const auto& dataSyncCfg = dataSyncCfgs[index];
+        auto removedCfg = std::ranges::find(removedCfgs, dataSyncCfg._path,
+                                            &config::DataSyncConfig::_path);
+        if (removedCfg == removedCfgs.end())
+        {
+            lg2::info("Start syncing the added path [{PATH}]", "PATH",
+                      dataSyncCfg._path);
+            _ctx.spawn(startAddedDataSync(dataSyncCfg));
+            continue;
+        }
+
+        lg2::info("Restart syncing the reconfigured path [{PATH}]", "PATH",
+                  dataSyncCfg._path);
+
+        // Sync the reconfigured path once again only if the synced data or
+        // its destination is changed, or it is synced for the first time.
+        if ((dataSyncCfg._destPath != removedCfg->_destPath) ||
+            (dataSyncCfg._excludeFileList != removedCfg->_excludeFileList) ||
+            (dataSyncCfg._includeFileList != removedCfg->_includeFileList) ||
+            !isSyncEligible(*removedCfg))
+        {
+            _ctx.spawn(startAddedDataSync(dataSyncCfg));
+        }
+        else if (isSyncEligible(dataSyncCfg))
+        {
+            startSyncEvent(dataSyncCfg);
+        }
+        removedCfgs.erase(removedCfg);
+    }
+
+    for (const auto& removedCfg : removedCfgs)
+    {
+        lg2::info("Stop syncing the removed path [{PATH}]", "PATH",
+                  removedCfg._path);
+    }
+
+    _dataSyncConfiguration = config::ConfigStore(dataSyncCfgs);
+    _syncPlan.reset();
+}
+
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::syncData(config::DataSyncConfig dataSyncCfg,
+                      std::stop_token stopToken, bool urgent)
+{
+    // The transfer which is queued before the cancellation is dropped.
+    if (stopToken.stop_requested())
+    {
+        co_return false;
+    }
+
+    // Pay off the debt of the previous transfers before starting a new one.
+    if (!co_await waitForRateLimit(stopToken))
+    {
+        co_return false;
+    }
+
+#ifndef UNIT_TEST
+    if (_extDataIfaces->siblingBmcIP().empty())
+    {
+        siblingUnreachable();
+        co_return false;
+    }
+    // TODO Support for remote (i,e sibling BMC) copying needs to be added.
+#endif
+
+    std::vector<std::string> syncArgs{"rsync", "--archive", "--stats"};
+
+    // Compress only if it pays off for the data.
+    auto compression = _compressionPolicy.decide(dataSyncCfg);
+    std::ranges::move(CompressionPolicy::rsyncArgs(compression),
+                      std::back_inserter(syncArgs));
+
+    // Pace the transfer itself by the strictest of the bandwidth limits.
+    std::optional<std::uint64_t> bandwidthLimit = dataSyncCfg._bandwidthLimit;
+    if (_byteRateLimit.rate() != 0)
+    {
+        auto globalLimit =
+            std::max<std::uint64_t>(_byteRateLimit.rate() / 1024, 1);
+        bandwidthLimit = std::min(bandwidthLimit.value_or(globalLimit),
+                                  globalLimit);
+    }
+    if (bandwidthLimit.has_value())
+    {
+        syncArgs.push_back("--bwlimit=" + std::to_string(*bandwidthLimit));
+    }
+
+    // Stage the synced file sharing the most content as the basis under
+    // the destination name, so that the shared chunks are matched rather
+    // than sent when the destination doesn't have the file yet. The basis
+    // is staged on the local file system as the transfers are local until
+    // the sibling transfer is supported.
+    auto destPath = dataSyncCfg._destPath.value_or(dataSyncCfg._path);
+    std::vector<ChunkIndex::Digest> digests;
+    std::optional<ChunkIndex::FileStamp> stamp;
+    std::optional<BasisDir> basisDir;
+    std::error_code ec;
+    auto isFile = std::filesystem::is_regular_file(dataSyncCfg._path, ec);
+    if (isFile && !isKeptTransfer(dataSyncCfg._path))
+    {
+        // The file is chunked again only if it is changed since indexed,
+        // the stamp is taken first to chunk it again if changed meanwhile.
+        stamp = ChunkIndex::stampFile(dataSyncCfg._path);
+        auto indexedDigests =
+            stamp.has_value() ? _chunkIndex.indexedDigests(destPath, *stamp)
+                              : std::nullopt;
+        if (indexedDigests.has_value())
+        {
+            digests = std::move(*indexedDigests);
+        }
+        else
+        {
+            digests = co_await runInTransferWorker(
+                [&dataSyncCfg]() {
+                return ChunkIndex::chunkFile(dataSyncCfg._path);
+            }, urgent);
+        }
+        if (auto basis = _chunkIndex.findBasis(destPath, digests))
+        {
+            basisDir = BasisDir::stage(*basis, destPath);
+        }
+        publishDedupStats();
+    }
+    if (basisDir.has_value())
+    {
+        // The delta transfer against the basis is disabled by default for
+        // the local transfers.
+        syncArgs.push_back("--copy-dest=" + basisDir->path().string());
+        syncArgs.emplace_back("--no-whole-file");
+    }
+
+    std::optional<std::uintmax_t> fileSize;
+    if (isFile)
+    {
+        auto size = std::filesystem::file_size(dataSyncCfg._path, ec);
+        fileSize = ec ? 0 : size;
+    }
+    std::ranges::move(largeFileArgs(fileSize), std::back_inserter(syncArgs));
+    syncArgs.push_back(dataSyncCfg._path);
+
+    // Add destination data path
+    syncArgs.push_back(destPath);
+
+    std::array<int, 2> pipeFds{};
+    if (pipe2(pipeFds.data(), O_CLOEXEC) != 0)
+    {
+        lg2::error("Failed to create the pipe to sync {PATH}, errno: {ERRNO}",
+                   "PATH", dataSyncCfg._path, "ERRNO", errno);
+        co_return false;
+    }
+    FD outputFd{pipeFds[0]};
+    pid_t transferPid = -1;
+    {
+        // The write end is closed once it is passed to the transfer to get
+        // the end of the output once the transfer is exited.
+        FD transferOutputFd{pipeFds[1]};
+        transferPid = spawnTransfer(syncArgs, transferOutputFd(),
+                                    urgent ? _urgentTransferPriority
+                                           : _transferPriority);
+    }
+    if (transferPid < 0)
+    {
+        lg2::error("Failed to run the sync of {PATH}, errno: {ERRNO}", "PATH",
+                   dataSyncCfg._path, "ERRNO", errno);
+        co_return false;
+    }
+    fcntl(outputFd(), F_SETFL, O_NONBLOCK); // NOLINT
+
+    std::string stats;
+    {
+        // Kill the transfer once the sync is cancelled, the transfer is not
+        // reaped until the callback is removed.
+        std::stop_callback killTransfer(
+            stopToken, [transferPid]() { kill(transferPid, SIGTERM); });
+        stats = co_await readTransferOutput(outputFd());
+    }
+    int result = 0;
+    struct rusage transferUsage{};
+    wait4(transferPid, &result, 0, &transferUsage);
+
+    // The literal data sent on the link is the bytes sent except the file
+    // list, the rest of the protocol is a few bytes per transferred file.
+    auto sentBytes = parseStatsNumber(stats, "Total bytes sent: ").value_or(0);
+    auto fileListSize =
+        parseStatsNumber(stats, "File list size: ").value_or(0);
+    _compressionPolicy.record(
+        dataSyncCfg._path, compression._level.has_value(),
+        parseStatsNumber(stats, "Literal data: ").value_or(0),
+        sentBytes > fileListSize ? sentBytes - fileListSize : 0,
+        std::chrono::seconds(transferUsage.ru_utime.tv_sec +
+                             transferUsage.ru_stime.tv_sec) +
+            std::chrono::microseconds(transferUsage.ru_utime.tv_usec +
+                                      transferUsage.ru_stime.tv_usec));
+    const auto& compressionStats = _compressionPolicy.stats();
+    _statisticsIface.compression_bytes_saved(compressionStats._bytesSaved);
+    _statisticsIface.compression_cpu_time_saved(
+        static_cast<std::uint64_t>(compressionStats._cpuTimeSaved.count()));
+    _statisticsIface.compressed_transfers(compressionStats._compressedCount);
+    _statisticsIface.uncompressed_transfers(
+        compressionStats._uncompressedCount);
+
+    auto transferredBytes = parseTransferredBytes(stats);
+    auto now = TokenBucket::Clock::now();
+    _byteRateLimit.consume(transferredBytes, now);
+    _fileRateLimit.consume(parseTransferredFiles(stats), now);
+
+    if (getFullSyncStatus() == FullSyncStatus::FullSyncInProgress)
+    {
+        _fullSyncProgress.transferred(transferredBytes);
+        scheduleFullSyncProgressEmit();
+    }
+
+    if (stopToken.stop_requested())
+    {
+        lg2::info("Cancelled syncing: {PATH}", "PATH", dataSyncCfg._path);
+        co_return false;
+    }
+
+    if (WIFEXITED(result) && isSiblingUnreachable(WEXITSTATUS(result)))
+    {
+        lg2::error("Unable to reach the sibling BMC to sync: {PATH}", "PATH",
+                   dataSyncCfg._path);
+        siblingUnreachable();
+        co_return false;
+    }
+    if (result != 0)
+    {
+        // TODO:
+        // Retry and create error log and disable redundancy if retry is failed.
+        lg2::error("Error syncing: {PATH}", "PATH", dataSyncCfg._path);
+
+        co_return false;
+    }
+
+    if (basisDir.has_value())
+    {
+        _chunkIndex.matched(
+            parseStatsNumber(stats, "Matched data: ").value_or(0));
+        publishDedupStats();
+    }
+    if (!digests.empty())
+    {
+        _chunkIndex.add(destPath, std::move(digests), stamp);
+    }
+    co_return true;
+}
+
+std::vector<std::string>
+    Manager::largeFileArgs(std::optional<std::uintmax_t> fileSize)
+{
+    // The directory is transferred without keeping the interrupted
+    // transfers, and the ones kept by the transfers of the large files next
+    // to the synced data are not synced.
+    if (!fileSize.has_value())
+    {
+        return {std::string("--exclude=") + largeFilePartialDir + "/"};
+    }
+    if (*fileSize < largeFileSize)
+    {
+        return {};
+    }
+
+    // Keep the interrupted transfer of the large file, so that the next
+    // transfer resumes from it and sends only the blocks which don't match
+    // the checksums of the kept blocks.
+    return {std::string("--partial-dir=") + largeFilePartialDir,
+            "--block-size=" + std::to_string(largeFileBlockSize)};
+}
+
+void Manager::publishDedupStats()
+{
+    const auto& dedupStats = _chunkIndex.stats();
+    _statisticsIface.dedup_lookup_chunks(dedupStats._lookupChunks);
+    _statisticsIface.dedup_hit_chunks(dedupStats._hitChunks);
+    _statisticsIface.dedup_basis_transfers(dedupStats._basisCount);
+    _statisticsIface.dedup_matched_bytes(dedupStats._matchedBytes);
+}
+
+pid_t Manager::spawnTransfer(const std::vector<std::string>& syncArgs,
+                             int outputFd,
+                             const transfer::Priority& priority)
+{
+    std::vector<char*> argv;
+    argv.reserve(syncArgs.size() + 1);
+    for (const auto& syncArg : syncArgs)
+    {
+        argv.push_back(const_cast<char*>(syncArg.c_str())); // NOLINT
+    }
+    argv.push_back(nullptr);
+
+    // The forked process of the multithreaded daemon may make only the
+    // async-signal-safe calls, hence the executable is found and the cgroup
+    // is opened before the fork.
+    auto executable = findExecutable(syncArgs.front());
+    FD cgroupProcs{priority._cgroupProcs.has_value()
+                       ? open(priority._cgroupProcs->c_str(),
+                              O_WRONLY | O_CLOEXEC)
+                       : -1};
+    if (priority._cgroupProcs.has_value() && cgroupProcs() < 0)
+    {
+        lg2::error("Failed to open {CGROUP_PROCS} to move the transfer into, "
+                   "errno: {ERRNO}",
+                   "CGROUP_PROCS", *priority._cgroupProcs, "ERRNO", errno);
+    }
+
+    // The priority is applied before the exec so that the processes forked
+    // by the transfer inherit it.
+    auto transferPid = fork();
+    if (transferPid == 0)
+    {
+        dup2(outputFd, STDOUT_FILENO);
+        transfer::applyPriority(priority, cgroupProcs());
+        execve(executable.c_str(), argv.data(), environ);
+        _exit(transferExecFailure);
+    }
+    return transferPid;
+}
+
+sdbusplus::async::task<std::string>
+    // NOLINTNEXTLINE
+    Manager::readTransferOutput(int outputFd)
+{
+    sdbusplus::async::fdio outputIo(_ctx, outputFd);
+
+    std::string output;
+    std::array<char, 256> buffer{};
+    while (true)
+    {
+        auto readSize = read(outputFd, buffer.data(), buffer.size());
+        if (readSize > 0)
+        {
+            output.append(buffer.data(), static_cast<std::size_t>(readSize));
+        }
+        else if (readSize < 0 && errno == EAGAIN)
+        {
+            co_await outputIo.next();
+        }
+        else if (readSize == 0 || errno != EINTR)
+        {
+            break;
+        }
+    }
+    co_return output;
+}
+
+bool Manager::isSiblingUnreachable(int exitCode)
+{
+    // The rsync exit codes of the connection failures, the 255 is returned
+    // by the remote shell.
+    constexpr std::array unreachableExitCodes{5, 10, 12, 30, 35, 255};
+    return std::ranges::contains(unreachableExitCodes, exitCode);
+}
+
+std::uint64_t Manager::parseTransferredBytes(std::string_view stats)
+{
+    return parseStatsNumber(stats, "Total transferred file size: ").value_or(0);
+}
+
+std::uint64_t Manager::parseTransferredFiles(std::string_view stats)
+{
+    // The older rsync doesn't count the regular files separately.
+    auto files = parseStatsNumber(stats,
+                                  "Number of regular files transferred: ");
+    if (!files.has_value())
+    {
+        files = parseStatsNumber(stats, "Number of files transferred: ");
+    }
+    return files.value_or(0);
+}
+
+void Manager::setSyncRateLimit(std::uint64_t bandwidthLimit,
+                               std::uint64_t fileRateLimit,
+                               std::chrono::seconds burst)
+{
+    // The limits saturate instead of wrapping around to a tiny limit.
+    constexpr auto maxLimit = std::numeric_limits<std::uint64_t>::max();
+    auto burstSeconds = static_cast<std::uint64_t>(burst.count());
+    auto byteRate =
+        TokenBucket::checkedMul(bandwidthLimit, 1024).value_or(maxLimit);
+    auto now = TokenBucket::Clock::now();
+    _byteRateLimit.configure(
+        byteRate,
+        TokenBucket::checkedMul(byteRate, burstSeconds).value_or(maxLimit),
+        now);
+    _fileRateLimit.configure(
+        fileRateLimit,
+        TokenBucket::checkedMul(fileRateLimit, burstSeconds).value_or(maxLimit),
+        now);
+    _rateLimitIface.bandwidth_limit(bandwidthLimit);
+    _rateLimitIface.file_rate_limit(fileRateLimit);
+    _rateLimitIface.burst(static_cast<std::uint64_t>(burst.count()));
+    lg2::info("Set the sync rate limit to {BANDWIDTH_LIMIT} KiB/s and "
+              "{FILE_RATE_LIMIT} files/s with the burst of {BURST_SEC} sec",
+              "BANDWIDTH_LIMIT", bandwidthLimit, "FILE_RATE_LIMIT",
+              fileRateLimit, "BURST_SEC", burst.count());
+}
+
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::waitForRateLimit(std::stop_token stopToken)
+{
+    while (!stopToken.stop_requested() && !_ctx.stop_requested())
+    {
+        auto now = TokenBucket::Clock::now();
+        auto delay = std::max(_byteRateLimit.delay(now),
+                              _fileRateLimit.delay(now));
+        if (delay == TokenBucket::Clock::duration::zero())
+        {
+            co_return true;
+        }
+
+        // The delay is rechecked in a while to follow the limit which is
+        // adjusted meanwhile.
+        co_await sdbusplus::async::sleep_for(
+            _ctx, std::min<TokenBucket::Clock::duration>(
+                      delay, rateLimitRecheckInterval));
+    }
+    co_return false;
+}
+
+void Manager::scheduleFullSyncProgressEmit()
+{
+    if (std::exchange(_fullSyncProgressEmitPending, true))
+    {
+        return;
+    }
+    _ctx.spawn(emitFullSyncProgress());
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::emitFullSyncProgress()
+{
+    auto now = FullSyncProgressTracker::Clock::now();
+    if (_fullSyncProgress.nextEmitTime() > now)
+    {
+        co_await sdbusplus::async::sleep_for(
+            _ctx, _fullSyncProgress.nextEmitTime() - now);
+    }
+
+    // The progress is emitted already if the full sync is finished
+    // meanwhile.
+    if (_fullSyncProgressEmitPending)
+    {
+        publishFullSyncProgress();
+    }
+    co_return;
+}
+
+void Manager::publishFullSyncProgress()
+{
+    _fullSyncProgressEmitPending = false;
+    const auto& progress =
+        _fullSyncProgress.emit(FullSyncProgressTracker::Clock::now());
+
+    _fullSyncIface.synced_count(progress._syncedCount);
+    _fullSyncIface.total_count(progress._totalCount);
+    _fullSyncIface.transferred_bytes(progress._transferredBytes);
+    _fullSyncIface.throughput(progress._throughput);
+    _fullSyncIface.remaining_time(
+        progress._eta.has_value()
+            ? static_cast<std::uint64_t>(progress._eta->count())
+            : std::numeric_limits<std::uint64_t>::max());
+    _fullSyncIface.resumed(progress._resumed);
+}
+
+FullSyncProgress Manager::getFullSyncProgress() const
+{
+    FullSyncProgress progress;
+    progress._syncedCount = _fullSyncIface.synced_count();
+    progress._totalCount = _fullSyncIface.total_count();
+    progress._transferredBytes = _fullSyncIface.transferred_bytes();
+    progress._throughput = _fullSyncIface.throughput();
+    if (_fullSyncIface.remaining_time() !=
+        std::numeric_limits<std::uint64_t>::max())
+    {
+        progress._eta = std::chrono::seconds(_fullSyncIface.remaining_time());
+    }
+    progress._resumed = _fullSyncIface.resumed();
+    return progress;
+}
+
+void Manager::siblingUnreachable()
+{
+    if (!std::exchange(_siblingReachable, false))
+    {
+        return;
+    }
+    lg2::warning("The sibling BMC is unreachable, queueing the changes until "
+                 "it is reachable");
+    _ctx.spawn(replayOfflineChanges());
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::replayOfflineChanges()
+{
+    while (!_ctx.stop_requested())
+    {
+        co_await sdbusplus::async::sleep_for(_ctx, siblingProbeInterval);
+
+        // Try syncing the queued changes, the sibling is marked unreachable
+        // again if it is still down.
+        _siblingReachable = true;
+        auto replayStartTime = std::chrono::steady_clock::now();
+
+        std::size_t replayedCount = 0;
+        if (_changeLog.overflowed())
+        {
+            lg2::info("The offline change queue is overflowed, starting the "
+                      "full sync");
+            _changeLog.reset();
+            co_await startFullSync();
+        }
+        else
+        {
+            replayedCount = co_await syncPendingChanges();
+        }
+
+        if (_siblingReachable)
+        {
+            lg2::info("The sibling BMC is reachable, replayed the changes of "
+                      "{COUNT} paths in {DURATION_MS} ms",
+                      "COUNT", replayedCount, "DURATION_MS",
+                      std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - replayStartTime)
+                          .count());
+            break;
+        }
+    }
+    co_return;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<bool> Manager::recordOfflineChanges()
+{
+    const auto& shutdownFingerprints = _changeJournal.shutdownFingerprints();
+    if (!shutdownFingerprints.has_value())
+    {
+        lg2::info("The data changed while the daemon is down is not known as "
+                  "it is not stopped gracefully");
+        co_return false;
+    }
+
+    std::vector<std::string> cfgPaths;
+    for (auto index : fullSyncCfgs({}))
+    {
+        cfgPaths.push_back(_dataSyncConfiguration[index]._path);
+    }
+
+    // The data is walked off the event loop.
+    auto fingerprints = co_await runInTransferWorker([&cfgPaths]() {
+        std::vector<std::uint64_t> fingerprints;
+        fingerprints.reserve(cfgPaths.size());
+        for (const auto& cfgPath : cfgPaths)
+        {
+            fingerprints.push_back(sourceFingerprint(cfgPath));
+        }
+        return fingerprints;
+    });
+
+    std::size_t changedCount = 0;
+    for (std::size_t index = 0; index < cfgPaths.size(); ++index)
+    {
+        _sourceFingerprints.insert_or_assign(cfgPaths[index],
+                                             fingerprints[index]);
+        auto shutdownFingerprint = shutdownFingerprints->find(cfgPaths[index]);
+        if (shutdownFingerprint == shutdownFingerprints->end() ||
+            shutdownFingerprint->second != fingerprints[index])
+        {
+            std::error_code ec;
+            recordChange(cfgPaths[index],
+                         fs::is_directory(cfgPaths[index], ec));
+            ++changedCount;
+        }
+    }
+    lg2::info("Found {COUNT} data changed while the daemon is down", "COUNT",
+              changedCount);
+    co_return true;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<std::size_t> Manager::syncPendingChanges()
+{
+    // The changes are replayed in the tier order as the full sync.
+    std::vector<config::DataSyncConfig> pendingCfgs;
+    for (auto index : fullSyncCfgs({}))
+    {
+        auto dataSyncCfg = _dataSyncConfiguration[index];
+        if (_changeLog.hasPendingChanges(dataSyncCfg._path))
+        {
+            pendingCfgs.push_back(std::move(dataSyncCfg));
+        }
+    }
+
+    std::size_t syncedCount = 0;
+    for (auto& dataSyncCfg : pendingCfgs)
+    {
+        if (!_siblingReachable)
+        {
+            break;
+        }
+        co_await syncChangedData(std::move(dataSyncCfg));
+        ++syncedCount;
+    }
+    co_return syncedCount;
+}
+
+void Manager::recordChange(const std::string& path, bool isDir)
+{
+    auto changedPath = path;
+    if (isDir && !changedPath.ends_with('/'))
+    {
+        changedPath.push_back('/');
+    }
+
+    auto sequence = _changeLog.record(changedPath);
+    if (_changeLog.overflowed())
+    {
+        _changeJournal.logOverflow();
+    }
+    else
+    {
+        _changeJournal.logChange(changedPath, sequence);
+    }
+    scheduleJournalCommit();
+}
 
-namespace data_sync
+void Manager::confirmChanges(const std::string& cfgPath,
+                             ChangeLog::Sequence sequence)
 {
+    _changeLog.confirm(cfgPath, sequence);
+    _changeJournal.logConfirm(cfgPath, sequence);
+    scheduleJournalCommit();
+}
 
-Manager::Manager(sdbusplus::async::context& ctx,
-                 std::unique_ptr<ext_data::ExternalDataIFaces>&& extDataIfaces,
-                 const fs::path& dataSyncCfgDir) :
-    _ctx(ctx), _extDataIfaces(std::move(extDataIfaces)),
-    _dataSyncCfgDir(dataSyncCfgDir), _syncBMCDataIface(ctx, *this)
+void Manager::scheduleJournalCommit()
 {
-    _ctx.spawn(init());
+    if (!std::exchange(_journalCommitPending, true))
+    {
+        _ctx.spawn(commitJournal());
+    }
 }
 
 // NOLINTNEXTLINE
-sdbusplus::async::task<> Manager::init()
+sdbusplus::async::task<> Manager::commitJournal()
 {
-    co_await sdbusplus::async::execution::when_all(
-        parseConfiguration(), _extDataIfaces->startExtDataFetches());
+    // Group the records journaled meanwhile into a single commit.
+    co_await sdbusplus::async::sleep_for(_ctx, journalCommitInterval);
+    _journalCommitPending = false;
 
-    // TODO: Explore the possibility of running FullSync and Background Sync
-    // concurrently
-    if (_extDataIfaces->bmcRedundancy())
+    if (_changeJournal.needsCompaction())
     {
-        co_await startFullSync();
+        _changeJournal.compact(_changeLog);
     }
-
-    co_return co_await startSyncEvents();
+    else
+    {
+        _changeJournal.commit();
+    }
+    co_return;
 }
 
-// NOLINTNEXTLINE
-sdbusplus::async::task<> Manager::parseConfiguration()
+std::uint64_t Manager::sourceFingerprint(const std::string& path)
 {
-    auto parse = [this](const auto& configFile) {
-        try
+    // Hash the size and the modification time of the data like the quick
+    // check of rsync.
+    auto hash = fnv1a({});
+    auto hashEntry = [&hash](const fs::path& entryPath) {
+        struct stat entryStat{};
+        if (lstat(entryPath.c_str(), &entryStat) != 0)
         {
-            std::ifstream file;
-            file.open(configFile.path());
-
-            nlohmann::json configJSON(nlohmann::json::parse(file));
-
-            if (configJSON.contains("Files"))
-            {
-                std::ranges::transform(
-                    configJSON["Files"],
-                    std::back_inserter(this->_dataSyncConfiguration),
-                    [](const auto& element) {
-                    return config::DataSyncConfig(element);
-                });
-            }
-            if (configJSON.contains("Directories"))
-            {
-                std::ranges::transform(
-                    configJSON["Directories"],
-                    std::back_inserter(this->_dataSyncConfiguration),
-                    [](const auto& element) {
-                    return config::DataSyncConfig(element);
-                });
-            }
+            return;
         }
-        catch (const std::exception& e)
+        std::array<std::int64_t, 3> entry{
+            static_cast<std::int64_t>(entryStat.st_size),
+            static_cast<std::int64_t>(entryStat.st_mtim.tv_sec),
+            static_cast<std::int64_t>(entryStat.st_mtim.tv_nsec)};
+        hash = fnv1a(entryPath.native(), hash);
+        hash = fnv1a(
+            {// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+             reinterpret_cast<const char*>(entry.data()),
+             entry.size() * sizeof(std::int64_t)},
+            hash);
+    };
+
+    hashEntry(path);
+    std::error_code ec;
+    if (fs::is_directory(path, ec))
+    {
+        for (const auto& entry : fs::recursive_directory_iterator(
+                 path, fs::directory_options::skip_permission_denied, ec))
         {
-            // TODO Create error log
-            lg2::error("Failed to parse the configuration file : {CONFIG_FILE},"
-                       " exception : {EXCEPTION}",
-                       "CONFIG_FILE", configFile.path(), "EXCEPTION", e);
+            hashEntry(entry.path());
         }
-    };
+    }
+    return hash;
+}
 
-    if (fs::exists(_dataSyncCfgDir) && fs::is_directory(_dataSyncCfgDir))
+std::uint64_t Manager::configFingerprint() const
+{
+    auto hash = fnv1a({});
+    for (const auto& [cfgFile, configFile] : _configFiles)
     {
-        std::ranges::for_each(fs::directory_iterator(_dataSyncCfgDir), parse);
+        hash = fnv1a(cfgFile, hash);
+        hash = fnv1a(
+            {// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+             reinterpret_cast<const char*>(&configFile._sourceFile._hash),
+             sizeof(configFile._sourceFile._hash)},
+            hash);
     }
+    return hash;
+}
 
-    co_return;
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::syncChangedData(config::DataSyncConfig dataSyncCfg,
+                             std::stop_token stopToken, bool urgent,
+                             std::optional<std::uint64_t> fingerprint)
+{
+    // Keep the changes queued while the sibling is unreachable, they are
+    // replayed once it is reachable.
+    if (!_siblingReachable)
+    {
+        co_return false;
+    }
+
+    // The changes logged while syncing are confirmed by the next sync, the
+    // fingerprint is taken before syncing for the same reason.
+    auto sequence = _changeLog.sequence();
+    if (!fingerprint.has_value())
+    {
+        fingerprint = co_await runInTransferWorker(
+            [cfgPath = dataSyncCfg._path]() {
+            return sourceFingerprint(cfgPath);
+        }, urgent);
+    }
+    auto synced = co_await syncData(dataSyncCfg, stopToken, urgent);
+    if (synced)
+    {
+        confirmChanges(dataSyncCfg._path, sequence);
+        _sourceFingerprints.insert_or_assign(dataSyncCfg._path, *fingerprint);
+    }
+    co_return synced;
 }
 
-bool Manager::isSyncEligible(const config::DataSyncConfig& dataSyncCfg)
+void Manager::scheduleSync(const config::DataSyncConfig& dataSyncCfg)
 {
-    using enum config::SyncDirection;
-    using enum ext_data::BMCRole;
+    std::chrono::milliseconds latency = defaultImmediateSyncLatency;
+    if (dataSyncCfg._maxSyncLatency.has_value())
+    {
+        latency = *dataSyncCfg._maxSyncLatency;
+    }
+    else if (dataSyncCfg._periodicityInSec.has_value())
+    {
+        latency = *dataSyncCfg._periodicityInSec;
+    }
 
-    if ((dataSyncCfg._syncDirection == Bidirectional) ||
-        ((dataSyncCfg._syncDirection == Active2Passive) &&
-         this->_extDataIfaces->bmcRole() == Active) ||
-        ((dataSyncCfg._syncDirection == Passive2Active) &&
-         this->_extDataIfaces->bmcRole() == Passive))
+    _syncScheduler.submit(dataSyncCfg, SyncScheduler::Clock::now() + latency);
+    dispatchSyncs();
+}
+
+void Manager::dispatchSyncs()
+{
+    while (auto job = _syncScheduler.start())
     {
-        return true;
+        _ctx.spawn(runScheduledSync(std::move(*job)));
     }
-    else
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::runScheduledSync(SyncScheduler::Job job)
+{
+    // The configuration may be removed or not eligible in the new role
+    // while queued.
+    if (_dataSyncConfiguration.contains(job._dataSyncCfg) &&
+        isSyncEligible(job._dataSyncCfg))
+    {
+        // Raise the priority of the sync which is about to miss its deadline
+        // while queued.
+        auto urgent = job._deadline - SyncScheduler::Clock::now() <=
+                      urgentSyncMargin;
+        co_await syncChangedData(job._dataSyncCfg, {}, urgent);
+    }
+
+    if (_syncScheduler.finish(job, SyncScheduler::Clock::now()))
     {
-        // TODO Trace is required, will overflow?
-        lg2::debug("Sync is not required for [{PATH}] due to "
-                   "SyncDirection: {SYNC_DIRECTION} BMCRole: {BMC_ROLE}",
-                   "PATH", dataSyncCfg._path, "SYNC_DIRECTION",
-                   dataSyncCfg.getSyncDirectionInStr(), "BMC_ROLE",
-                   _extDataIfaces->bmcRole());
+        auto missCount = _syncScheduler.deadlineMisses(job._dataSyncCfg._path);
+        lg2::warning("Missed the sync deadline of {PATH}, misses: {COUNT}",
+                     "PATH", job._dataSyncCfg._path, "COUNT", missCount);
+
+        auto deadlineMisses = _rateLimitIface.deadline_misses();
+        deadlineMisses.insert_or_assign(job._dataSyncCfg._path, missCount);
+        _rateLimitIface.deadline_misses(std::move(deadlineMisses));
+    }
+    dispatchSyncs();
+    co_return;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::resyncChangedData(std::vector<config::DataSyncConfig> dataSyncCfgs)
+{
+    auto resyncStartTime = std::chrono::steady_clock::now();
+
+    std::size_t failedCount = 0;
+    for (auto& dataSyncCfg : dataSyncCfgs)
+    {
+        if (!co_await syncChangedData(std::move(dataSyncCfg)))
+        {
+            ++failedCount;
+        }
     }
-    return false;
+
+    lg2::info("Resynced the changed data of {COUNT} paths after the role "
+              "switch in {DURATION_MS} ms, failed: {FAILED_COUNT}",
+              "COUNT", dataSyncCfgs.size(), "DURATION_MS",
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - resyncStartTime)
+                  .count(),
+              "FAILED_COUNT", failedCount);
+    co_return;
 }
 
 // NOLINTNEXTLINE
-sdbusplus::async::task<> Manager::startSyncEvents()
+sdbusplus::async::task<> Manager::monitorDataToSync(
+    config::DataSyncConfig dataSyncCfg, std::stop_token stopToken)
 {
-    std::ranges::for_each(
-        _dataSyncConfiguration |
-            std::views::filter([this](const auto& dataSyncCfg) {
-        return this->isSyncEligible(dataSyncCfg);
-    }),
-        [this](const auto& dataSyncCfg) {
-        using enum config::SyncType;
-        if (dataSyncCfg._syncType == Immediate)
+    namespace inotify = watch::inotify;
+
+    // The data missing now is monitored once it is created.
+    std::unique_ptr<inotify::DataWatcher> dataWatcher;
+    try
+    {
+        dataWatcher = std::make_unique<inotify::DataWatcher>(_ctx,
+                                                             IN_CLOEXEC);
+    }
+    catch (const std::system_error& e)
+    {
+        lg2::error("Unable to monitor the data to sync : {PATH}, exception : "
+                   "{EXCEPTION}",
+                   "PATH", dataSyncCfg._path, "EXCEPTION", e);
+        co_return;
+    }
+    if (!dataWatcher->watchDataPath(dataSyncCfg._path,
+                                    IN_CLOSE_WRITE | IN_CREATE | IN_DELETE |
+                                        IN_MOVED_FROM | IN_MOVED_TO))
+    {
+        lg2::error("Unable to monitor the data to sync : {PATH}", "PATH",
+                   dataSyncCfg._path);
+        co_return;
+    }
+
+    while (!_ctx.stop_requested() && !stopToken.stop_requested())
+    {
+        auto events = co_await dataWatcher->onDataChange(stopToken);
+
+        // The configuration may be removed while waiting.
+        if (stopToken.stop_requested())
+        {
+            break;
+        }
+
+        // The kept transfers of the large files are not synced.
+        auto changed = false;
+        for (const auto& event : events)
         {
-            this->_ctx.spawn(this->monitorDataToSync(dataSyncCfg));
+            if (isKeptTransfer(event._path))
+            {
+                continue;
+            }
+            std::error_code ec;
+            recordChange(event._path.string(),
+                         (event._mask & IN_ISDIR) != 0 ||
+                             fs::is_directory(event._path, ec));
+            changed = true;
         }
-        else if (dataSyncCfg._syncType == Periodic)
+        if (changed)
         {
-            this->_ctx.spawn(this->monitorTimerToSync(dataSyncCfg));
+            scheduleSync(dataSyncCfg);
         }
-    });
+    }
     co_return;
 }
 
-// TODO: This isn't truly an async operation — Need to use popen/posix_spawn to
-// run the rsync command asynchronously but it will be handled as part of
-// concurrent sync changes.
-sdbusplus::async::task<bool>
+sdbusplus::async::task<>
     // NOLINTNEXTLINE
-    Manager::syncData(const config::DataSyncConfig& dataSyncCfg)
+    Manager::monitorTimerToSync(config::DataSyncConfig dataSyncCfg,
+                                std::stop_token stopToken)
 {
-    using namespace std::string_literals;
-    std::string syncCmd{"rsync --archive --compress"};
-    syncCmd.append(" "s + dataSyncCfg._path);
+    while (!_ctx.stop_requested() && !stopToken.stop_requested())
+    {
+        co_await sdbusplus::async::sleep_for(
+            _ctx, dataSyncCfg._periodicityInSec.value());
 
-#ifdef UNIT_TEST
-    syncCmd.append(" "s);
-#else
-    // TODO Support for remote (i,e sibling BMC) copying needs to be added.
-#endif
+        // The configuration may be removed while sleeping.
+        if (stopToken.stop_requested())
+        {
+            break;
+        }
 
-    // Add destination data path
-    syncCmd.append(dataSyncCfg._destPath.value_or(dataSyncCfg._path));
-    int result = std::system(syncCmd.c_str()); // NOLINT
-    if (result != 0)
+        // The changes are not known until synced, hence log the path.
+        std::error_code ec;
+        recordChange(dataSyncCfg._path,
+                     fs::is_directory(dataSyncCfg._path, ec));
+        scheduleSync(dataSyncCfg);
+    }
+    co_return;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::monitorPathTemplate(
+        std::shared_ptr<config::PathTemplate> pathTemplate,
+        std::stop_token stopToken)
+{
+    namespace inotify = watch::inotify;
+
+    std::unique_ptr<inotify::DataWatcher> dataWatcher;
+    try
     {
-        // TODO:
-        // Retry and create error log and disable redundancy if retry is failed.
-        lg2::error("Error syncing: {PATH}", "PATH", dataSyncCfg._path);
+        dataWatcher = std::make_unique<inotify::DataWatcher>(
+            _ctx, IN_CLOEXEC,
+            IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_ONLYDIR,
+            pathTemplate->parentDir());
+    }
+    catch (const std::system_error& e)
+    {
+        lg2::error("Unable to monitor the new instances of the path template "
+                   ": {PATH}, exception : {EXCEPTION}",
+                   "PATH", pathTemplate->templateCfg()._path, "EXCEPTION", e);
+        co_return;
+    }
 
-        co_return false;
+    // Cover the instances created after the configuration is parsed and
+    // before the watch is added. Only the uncached instances are returned.
+    for (auto& dataSyncCfg : pathTemplate->expand())
+    {
+        if (stopToken.stop_requested())
+        {
+            co_return;
+        }
+        co_await startExpandedDataSync(std::move(dataSyncCfg));
     }
-    co_return true;
+
+    while (!_ctx.stop_requested() && !stopToken.stop_requested())
+    {
+        auto events = co_await dataWatcher->onDataChange(stopToken);
+
+        // The path template may be removed while waiting.
+        if (stopToken.stop_requested())
+        {
+            break;
+        }
+
+        for (const auto& event : events)
+        {
+            // The instances are only the entries of the parent directory.
+            if (event._path.parent_path() != pathTemplate->parentDir())
+            {
+                continue;
+            }
+
+            if ((event._mask & (IN_DELETE | IN_MOVED_FROM)) != 0)
+            {
+                auto dataSyncCfg = pathTemplate->removeEntry(event._name);
+                if (dataSyncCfg.has_value())
+                {
+                    stopExpandedDataSync(*dataSyncCfg);
+                }
+                continue;
+            }
+
+            auto dataSyncCfg = pathTemplate->expandEntry(event._name);
+            if (dataSyncCfg.has_value())
+            {
+                co_await startExpandedDataSync(std::move(*dataSyncCfg));
+            }
+        }
+    }
+    co_return;
 }
 
-// NOLINTNEXTLINE
-sdbusplus::async::task<> Manager::monitorDataToSync(
-    [[maybe_unused]] const config::DataSyncConfig& dataSyncCfg)
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::startExpandedDataSync(config::DataSyncConfig dataSyncCfg)
 {
-    // TODO Create inotify events to monitor data for sync
+    lg2::info("Found the new instance [{PATH}] of the path template", "PATH",
+              dataSyncCfg._path);
+
+    _dataSyncConfiguration.add(dataSyncCfg);
+    _syncPlan.reset();
+
+    co_await startAddedDataSync(std::move(dataSyncCfg));
     co_return;
 }
 
+void Manager::stopExpandedDataSync(const config::DataSyncConfig& dataSyncCfg)
+{
+    lg2::info("The instance [{PATH}] of the path template is removed", "PATH",
+              dataSyncCfg._path);
+
+    stopSyncEvent(dataSyncCfg);
+    _dataSyncConfiguration.remove(dataSyncCfg);
+    _syncPlan.reset();
+}
+
 sdbusplus::async::task<>
     // NOLINTNEXTLINE
-    Manager::monitorTimerToSync(const config::DataSyncConfig& dataSyncCfg)
+    Manager::startAddedDataSync(config::DataSyncConfig dataSyncCfg)
 {
-    while (!_ctx.stop_requested())
+    if (!isSyncEligible(dataSyncCfg))
     {
-        co_await sdbusplus::async::sleep_for(
-            _ctx, dataSyncCfg._periodicityInSec.value());
-        co_await syncData(dataSyncCfg);
+        co_return;
+    }
+
+    // Start monitoring before syncing once to not miss the changes
+    // made while syncing.
+    startSyncEvent(dataSyncCfg);
+
+    // The full sync doesn't cover the added data, hence sync it once.
+    if (_extDataIfaces->bmcRedundancy())
+    {
+        co_await syncChangedData(dataSyncCfg);
     }
     co_return;
 }
 
 // NOLINTNEXTLINE
-sdbusplus::async::task<void> Manager::startFullSync()
+sdbusplus::async::task<void> Manager::startFullSync(FullSyncScope scope)
 {
+    // The cancelled full sync waits for its transfers to be killed, the
+    // status of it is not overwritten by this one.
+    while (getFullSyncStatus() == FullSyncStatus::FullSyncInProgress &&
+           _fullSyncStop.stop_requested() && !_ctx.stop_requested())
+    {
+        co_await sdbusplus::async::sleep_for(_ctx,
+                                             std::chrono::milliseconds(50));
+    }
+
+    auto scoped = scope._pathPrefix.has_value() ||
+                  scope._configFile.has_value();
+    if (scope._configFile.has_value() &&
+        !containsConfigFile(*scope._configFile))
+    {
+        lg2::error("Unable to sync the unknown configuration file: {FILE}",
+                   "FILE", *scope._configFile);
+        co_return;
+    }
+
+    auto prevStatus = getFullSyncStatus();
     _syncBMCDataIface.full_sync_status(FullSyncStatus::FullSyncInProgress);
+    _fullSyncIface.cancelled(false);
+    _fullSyncRole = _extDataIfaces->bmcRole();
     lg2::info("Full Sync started");
 
     auto fullSyncStartTime = std::chrono::steady_clock::now();
 
     auto syncResults = std::vector<bool>();
     size_t spawnedTasks = 0;
+    _fullSyncStop = std::stop_source{};
+    auto stopToken = _fullSyncStop.get_token();
+
+    // Resume the interrupted full sync of the same configuration by skipping
+    // the paths which are not changed since they are synced, the full sync
+    // of a scope doesn't checkpoint as it doesn't sync all the data.
+    auto cfgFingerprint = configFingerprint();
+    const auto& checkpoint = _changeJournal.fullSyncCheckpoint();
+    std::map<std::string, std::uint64_t, std::less<>> syncedPaths;
+    auto resumed = !scoped && checkpoint.has_value() &&
+                   checkpoint->_cfgFingerprint == cfgFingerprint;
+    if (resumed)
+    {
+        syncedPaths = checkpoint->_syncedPaths;
+    }
+    else if (!scoped)
+    {
+        _changeJournal.logFullSyncStart(cfgFingerprint);
+        scheduleJournalCommit();
+    }
 
-    for (const auto& cfg : _dataSyncConfiguration)
+    auto scopedCfgs = fullSyncCfgs(scope);
+    if (resumed)
     {
-        if (isSyncEligible(cfg))
+        lg2::info("Resuming the full sync of {TOTAL} paths from the checkpoint "
+                  "of {COUNT} synced paths",
+                  "TOTAL", scopedCfgs.size(), "COUNT", syncedPaths.size());
+    }
+    _fullSyncProgress.start(scopedCfgs.size(), resumed,
+                            FullSyncProgressTracker::Clock::now());
+    publishFullSyncProgress();
+    // Sync the tiers in order so that the critical data is ready to fail over
+    // as soon as possible, the data of a tier is synced concurrently.
+    std::map<std::uint8_t, FullSyncStatus> tierStatus;
+    for (auto index : scopedCfgs)
+    {
+        tierStatus.try_emplace(_dataSyncConfiguration.tier(index),
+                               FullSyncStatus::FullSyncNotStarted);
+    }
+    _fullSyncIface.tier_status(tierStatus);
+
+    auto tierBegin = scopedCfgs.begin();
+    while (tierBegin != scopedCfgs.end() && !stopToken.stop_requested())
+    {
+        auto tier = _dataSyncConfiguration.tier(*tierBegin);
+        auto tierEnd = std::find_if(tierBegin, scopedCfgs.end(),
+                                    [this, tier](auto index) {
+            return _dataSyncConfiguration.tier(index) != tier;
+        });
+        auto tierStartTime = std::chrono::steady_clock::now();
+        std::size_t tierFailedCount = 0;
+        tierStatus[tier] = FullSyncStatus::FullSyncInProgress;
+        _fullSyncIface.tier_status(tierStatus);
+
+        for (auto index : std::ranges::subrange(tierBegin, tierEnd))
         {
-            _ctx.spawn(
-                syncData(cfg) |
-                stdexec::then([&syncResults, &spawnedTasks](bool result) {
+            // Bound the concurrent transfers as all of them run at once
+            // otherwise.
+            while (spawnedTasks >= maxFullSyncTransfers &&
+                   !stopToken.stop_requested())
+            {
+                co_await sdbusplus::async::sleep_for(
+                    _ctx, std::chrono::milliseconds(50));
+            }
+            if (stopToken.stop_requested())
+            {
+                break;
+            }
+
+            auto dataSyncCfg = _dataSyncConfiguration[index];
+
+            // The fingerprint is taken before syncing to resync the data
+            // which is changed while syncing, the data is walked off the
+            // event loop.
+            auto fingerprint = co_await runInTransferWorker(
+                [cfgPath = dataSyncCfg._path]() {
+                return sourceFingerprint(cfgPath);
+            });
+            auto syncedPath = syncedPaths.find(dataSyncCfg._path);
+            if (syncedPath != syncedPaths.end() &&
+                syncedPath->second == fingerprint)
+            {
+                _fullSyncProgress.skipped();
+                continue;
+            }
+
+            // The critical tier is synced at the raised priority if the
+            // less critical tiers are synced after it.
+            auto urgent = tier == config::criticalTier &&
+                          tierStatus.size() > 1;
+            _ctx.spawn(syncChangedData(dataSyncCfg, stopToken, urgent,
+                                       fingerprint) |
+                       stdexec::then([this, &syncResults, &spawnedTasks,
+                                      &tierFailedCount, scoped,
+                                      cfgPath = dataSyncCfg._path,
+                                      fingerprint](bool result) {
+                if (result)
+                {
+                    if (!scoped)
+                    {
+                        _changeJournal.logFullSyncPath(cfgPath, fingerprint);
+                        scheduleJournalCommit();
+                    }
+                    _fullSyncProgress.synced();
+                    scheduleFullSyncProgressEmit();
+                }
+                else
+                {
+                    ++tierFailedCount;
+                }
                 syncResults.push_back(result);
                 spawnedTasks--; // Decrement the number of spawned tasks
             }));
             spawnedTasks++;     // Increment the number of spawned tasks
         }
+
+        while (spawnedTasks > 0)
+        {
+            co_await sdbusplus::async::sleep_for(
+                _ctx, std::chrono::milliseconds(50));
+        }
+
+        if (stopToken.stop_requested() || tierFailedCount > 0)
+        {
+            tierStatus[tier] = FullSyncStatus::FullSyncFailed;
+            lg2::error("Full Sync of the tier {TIER} failed", "TIER", tier);
+        }
+        else
+        {
+            tierStatus[tier] = FullSyncStatus::FullSyncCompleted;
+            lg2::info("Full Sync of the tier {TIER} completed in "
+                      "{DURATION_MS} ms",
+                      "TIER", tier, "DURATION_MS",
+                      std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - tierStartTime)
+                          .count());
+        }
+        _fullSyncIface.tier_status(tierStatus);
+        tierBegin = tierEnd;
     }
 
-    while (spawnedTasks > 0)
+    // The tiers which are not started are not synced once cancelled.
+    for (auto& status : tierStatus | std::views::values)
     {
-        co_await sdbusplus::async::sleep_for(_ctx,
-                                             std::chrono::milliseconds(50));
+        if (status == FullSyncStatus::FullSyncNotStarted)
+        {
+            status = FullSyncStatus::FullSyncFailed;
+        }
     }
+    _fullSyncIface.tier_status(tierStatus);
 
     auto fullSyncEndTime = std::chrono::steady_clock::now();
     auto FullsyncElapsedTime = std::chrono::duration_cast<std::chrono::seconds>(
         fullSyncEndTime - fullSyncStartTime);
 
+    // The final progress is emitted right away.
+    publishFullSyncProgress();
+
     // If any sync operation fails, the FullSync will be considered failed;
     // otherwise, it will be marked as completed.
-    if (std::ranges::all_of(syncResults,
-                            [](const auto& result) { return result; }))
+    if (stopToken.stop_requested())
     {
-        _syncBMCDataIface.full_sync_status(FullSyncStatus::FullSyncCompleted);
-        lg2::info("Full Sync completed successfully");
+        _syncBMCDataIface.full_sync_status(FullSyncStatus::FullSyncFailed);
+        _fullSyncIface.cancelled(true);
+        lg2::info("Full Sync cancelled, {COUNT} of {TOTAL} paths are synced",
+                  "COUNT", _fullSyncProgress.syncedCount(), "TOTAL",
+                  scopedCfgs.size());
     }
-    else
+    else if (!std::ranges::all_of(syncResults,
+                                  [](const auto& result) { return result; }))
     {
         _syncBMCDataIface.full_sync_status(FullSyncStatus::FullSyncFailed);
         lg2::info("Full Sync failed");
     }
+    else if (scoped)
+    {
+        // The sync of a scope doesn't change the state of all the data.
+        _syncBMCDataIface.full_sync_status(prevStatus);
+        lg2::info("Full Sync of the scope completed successfully, synced "
+                  "{COUNT} paths",
+                  "COUNT", scopedCfgs.size());
+    }
+    else
+    {
+        _syncBMCDataIface.full_sync_status(FullSyncStatus::FullSyncCompleted);
+        lg2::info("Full Sync completed successfully");
+
+        // The journal is compacted to drop the changes which are logged
+        // before the full sync.
+        _changeJournal.logFullSync(configFingerprint());
+        _changeJournal.compact(_changeLog);
+    }
 
     // total duration/time diff of the Full Sync operation
     lg2::info("Elapsed time for full sync: [{DURATION_SECONDS}] seconds",
@@ -242,4 +2177,62 @@ sdbusplus::async::task<void> Manager::startFullSync()
     co_return;
 }
 
+bool Manager::cancelFullSync()
+{
+    if (getFullSyncStatus() != FullSyncStatus::FullSyncInProgress)
+    {
+        return false;
+    }
+    lg2::info("Cancelling the full sync");
+    _fullSyncStop.request_stop();
+    return true;
+}
+
+std::vector<std::size_t> Manager::fullSyncCfgs(const FullSyncScope& scope)
+{
+    // The paths in the scope, the configured paths under them or covering
+    // them as merged by the planner are synced.
+    std::vector<std::string_view> scopePaths;
+    if (scope._pathPrefix.has_value())
+    {
+        scopePaths.emplace_back(*scope._pathPrefix);
+    }
+    if (scope._configFile.has_value())
+    {
+        for (const auto& dataSyncCfg :
+             _configFiles.at(*scope._configFile)._dataSyncCfgs)
+        {
+            scopePaths.emplace_back(dataSyncCfg._path);
+        }
+    }
+    auto inScope = [&scopePaths](std::string_view cfgPath) {
+        return scopePaths.empty() ||
+               std::ranges::any_of(scopePaths, [cfgPath](auto scopePath) {
+            return isPathUnder(cfgPath, scopePath) ||
+                   isPathUnder(scopePath, cfgPath);
+        });
+    };
+
+    const auto& plan = syncPlan();
+    std::vector<std::size_t> scopedCfgs;
+    scopedCfgs.reserve(plan.size());
+    for (auto syncType :
+         {config::SyncType::Immediate, config::SyncType::Periodic})
+    {
+        for (auto index : plan.cfgs(syncType))
+        {
+            if (inScope(_dataSyncConfiguration[index]._path))
+            {
+                scopedCfgs.push_back(index);
+            }
+        }
+    }
+
+    // The order of the plan is kept within a tier.
+    std::ranges::stable_sort(scopedCfgs, {}, [this](auto index) {
+        return _dataSyncConfiguration.tier(index);
+    });
+    return scopedCfgs;
+}
+
 } // namespace data_sync
@@ -2,12 +2,38 @@
 
 #pragma once
 
+#include "change_journal.hpp"
+#include "change_log.hpp"
+#include "chunk_index.hpp"
+#include "compression_policy.hpp"
+#include "config_cache.hpp"
+#include "config_store.hpp"
 #include "data_sync_config.hpp"
 #include "external_data_ifaces.hpp"
+#include "full_sync_progress.hpp"
+#include "path_template.hpp"
 #include "sync_bmc_data_ifaces.hpp"
+#include "sync_plan.hpp"
+#include "sync_scheduler.hpp"
+#include "token_bucket.hpp"
+#include "transfer_priority.hpp"
+#include "worker.hpp"
 
+#include <sys/types.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
 #include <ranges>
+#include <set>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace data_sync
@@ -18,6 +44,24 @@ using FullSyncStatus = sdbusplus::common::xyz::openbmc_project::control::
 
 namespace fs = std::filesystem;
 
+/**
+ * @brief The structure contains the scope of the full sync, all the
+ *        configured data is synced if no scope is given.
+ */
+struct FullSyncScope
+{
+    /**
+     * @brief Sync only the configured paths under the path prefix.
+     */
+    std::optional<std::string> _pathPrefix;
+
+    /**
+     * @brief Sync only the configured paths listed in the configuration
+     *        file.
+     */
+    std::optional<std::string> _configFile;
+};
+
 /**
  * @class Manager
  *
@@ -31,7 +75,12 @@ class Manager
     Manager& operator=(const Manager&) = delete;
     Manager(Manager&&) = delete;
     Manager& operator=(Manager&&) = delete;
-    ~Manager() = default;
+
+    /**
+     * @brief The destructor journals the fingerprints of the data to find
+     *        the data changed while the daemon is down.
+     */
+    ~Manager();
 
     /**
      * @brief The constructor parses the configuration, monitors the data, and
@@ -40,10 +89,13 @@ class Manager
      * @param[in] ctx - The async context
      * @param[in] extDataIfaces - The external data interfaces object
      * @param[in] dataSyncCfgDir - The data sync configuration directory
+     * @param[in] dataSyncPersistDir - The directory to persist the data
+     *                                 sync data like the config cache
      */
     Manager(sdbusplus::async::context& ctx,
             std::unique_ptr<ext_data::ExternalDataIFaces>&& extDataIfaces,
-            const fs::path& dataSyncCfgDir);
+            const fs::path& dataSyncCfgDir,
+            const fs::path& dataSyncPersistDir);
 
     /**
      * @brief An API helper to verify if the manager contains the given
@@ -55,7 +107,7 @@ class Manager
      */
     bool containsDataSyncCfg(const config::DataSyncConfig& dataSyncCfg)
     {
-        return std::ranges::contains(_dataSyncConfiguration, dataSyncCfg);
+        return _dataSyncConfiguration.contains(dataSyncCfg);
     }
 
     /**
@@ -64,9 +116,45 @@ class Manager
      *        - This method is responsible for initiating the  Full
      *          synchronization process between two BMCs.
      *        - The sync process is handled asynchronously.
+     *        - The interrupted full sync of the same configuration is
+     *          resumed by skipping the paths which are not changed since
+     *          they are synced.
+     *        - The tiers are synced in order, the data of a tier is synced
+     *          concurrently and the status of the tier is set once all of
+     *          it is synced.
+     *        - The full sync of a scope syncs only the configured paths
+     *          in the scope, it is not resumed and the full sync status is
+     *          restored once it is completed.
+     *
+     * @param[in] scope - The scope to sync, all the data if not given
+     */
+    sdbusplus::async::task<> startFullSync(FullSyncScope scope = {});
+
+    /**
+     * @brief Cancel the full sync in progress.
+     *
+     *        - The transfers in progress are killed and the queued ones are
+     *          dropped.
+     *        - The full sync is marked failed and cancelled, and it is
+     *          resumed from the checkpoint by the next full sync.
+     *
+     * @return True if cancelled; otherwise False if no full sync is in
+     *         progress.
+     */
+    bool cancelFullSync();
+
+    /**
+     * @brief Helper API to check whether the given configuration file is
+     *        parsed, to sync the scope of it.
      *
+     * @param[in] configFile - The configuration file
+     *
+     * @return True if parsed; otherwise False.
      */
-    sdbusplus::async::task<> startFullSync();
+    bool containsConfigFile(const std::string& configFile) const
+    {
+        return _configFiles.contains(configFile);
+    }
 
     /**
      * @brief Helper API that retrieves the sibling BMC IP and returns its
@@ -87,6 +175,132 @@ class Manager
         return _syncBMCDataIface.full_sync_status();
     }
 
+    /**
+     * @brief Helper API fetches the full sync Dbus cancelled-property.
+     */
+    bool isFullSyncCancelled() const
+    {
+        return _fullSyncIface.cancelled();
+    }
+
+    /**
+     * @brief Helper API fetches the full sync Dbus progress-properties.
+     */
+    FullSyncProgress getFullSyncProgress() const;
+
+    /**
+     * @brief Helper API fetches the full sync Dbus tier-status-property, the
+     *        BMC is ready to fail over the data of a tier once it is
+     *        completed.
+     */
+    std::map<std::uint8_t, FullSyncStatus> getFullSyncTierStatus() const
+    {
+        return _fullSyncIface.tier_status();
+    }
+
+    /**
+     * @brief Helper API fetches the number of the progress emissions of
+     *        the last full sync.
+     */
+    std::size_t getFullSyncProgressEmitCount() const
+    {
+        return _fullSyncProgress.emitCount();
+    }
+
+    /**
+     * @brief Helper API fetches the time taken to switch the sync events
+     *        once the BMC role is changed last time.
+     */
+    std::chrono::microseconds getRoleSwitchLatency() const
+    {
+        return std::chrono::microseconds(
+            _statisticsIface.role_switch_latency());
+    }
+
+    /**
+     * @brief Helper API fetches the number of the syncs of the given path
+     *        which are finished after their deadline.
+     *
+     * @param[in] path - The configured path
+     */
+    std::size_t getDeadlineMisses(const std::string& path) const
+    {
+        const auto& deadlineMisses = _rateLimitIface.deadline_misses();
+        auto deadlineMiss = deadlineMisses.find(path);
+        return deadlineMiss != deadlineMisses.end() ? deadlineMiss->second
+                                                    : 0;
+    }
+
+    /**
+     * @brief Helper API fetches the changes of the given configured path
+     *        which are not confirmed synced yet.
+     *
+     * @param[in] path - The configured path
+     */
+    std::vector<std::string> getPendingChanges(const std::string& path) const
+    {
+        return _changeLog.pendingChanges(path);
+    }
+
+    /**
+     * @brief Adjust the global rate limit of the sync traffic at runtime.
+     *
+     * @param[in] bandwidthLimit - The bandwidth limit in KiB per second,
+     *                             zero for no limit
+     * @param[in] fileRateLimit - The limit of the files per second, zero for
+     *                            no limit
+     * @param[in] burst - The burst allowed after an idle period, in terms of
+     *                    the time worth of the limits
+     *
+     * @note The syncs waiting for the limit follow the new limit right
+     *       away, the transfers in progress keep their bandwidth limit until
+     *       they are finished.
+     */
+    void setSyncRateLimit(std::uint64_t bandwidthLimit,
+                          std::uint64_t fileRateLimit,
+                          std::chrono::seconds burst);
+
+    /**
+     * @brief Helper API fetches the savings of the compression policy of
+     *        the transfers.
+     */
+    CompressionPolicy::Stats getCompressionStats() const
+    {
+        return {._bytesSaved = _statisticsIface.compression_bytes_saved(),
+                ._cpuTimeSaved = std::chrono::microseconds(
+                    _statisticsIface.compression_cpu_time_saved()),
+                ._compressedCount = static_cast<std::size_t>(
+                    _statisticsIface.compressed_transfers()),
+                ._uncompressedCount = static_cast<std::size_t>(
+                    _statisticsIface.uncompressed_transfers())};
+    }
+
+    /**
+     * @brief Helper API fetches the hit rate of the content index which
+     *        selects the basis of the transfers.
+     */
+    ChunkIndex::Stats getDedupStats() const
+    {
+        return {._lookupChunks = _statisticsIface.dedup_lookup_chunks(),
+                ._hitChunks = _statisticsIface.dedup_hit_chunks(),
+                ._basisCount = static_cast<std::size_t>(
+                    _statisticsIface.dedup_basis_transfers()),
+                ._matchedBytes = _statisticsIface.dedup_matched_bytes()};
+    }
+
+    /**
+     * @brief Helper API gets the rsync arguments to resume the interrupted
+     *        transfer of a large file.
+     *
+     * @param[in] fileSize - The size of the file to sync, nullopt if the
+     *                       data is a directory
+     *
+     * @return The rsync arguments, the ones to exclude the kept transfers
+     *         from the sync if the data is a directory.
+     */
+    static std::vector<std::string>
+        largeFileArgs(std::optional<std::uintmax_t> fileSize);
+
   private:
     /**
      * @brief A helper API to start the data sync operation.
@@ -97,9 +311,47 @@ class Manager
      * @brief A helper API to parse the data sync configuration
      *
      * @note It will continue parsing all files even if one file fails to parse.
+     *       The parsed configuration is loaded from the config cache if none
+     *       of the files are changed since the cache is stored.
      */
     sdbusplus::async::task<> parseConfiguration();
 
+    /**
+     * @brief A helper API to build the data sync configuration from the
+     *        parsed configuration files.
+     *
+     *        - The configuration directory overrides the builtin
+     *          configurations.
+     *        - The path templates are expanded into the concrete
+     *          configurations.
+     *        - The duplicate and nested paths across the files are merged to
+     *          avoid syncing and monitoring the same data twice.
+     *
+     * @return The data sync configuration
+     */
+    std::vector<config::DataSyncConfig> buildConfiguration();
+
+    /**
+     * @brief A helper API to move the configurations which contain the path
+     *        placeholder into the path templates and expand them into
+     *        the concrete configurations.
+     *
+     *        The already expanded path templates are kept as is and
+     *        the removed ones are stopped monitoring.
+     *
+     * @param[in,out] dataSyncCfgs - The configurations to expand
+     */
+    void expandPathTemplates(std::vector<config::DataSyncConfig>& dataSyncCfgs);
+
+    /**
+     * @brief A helper API to store the parsed configuration files into the
+     *        config cache.
+     *
+     * @note The cache is not stored if any of the files failed to parse to
+     *       report the parsing failures on every start.
+     */
+    void storeConfigCache() const;
+
     /**
      * @brief A helper API to initiate sync events, covering the following
      *        scenarios. These event will be initiated based on the BMC role.
@@ -108,45 +360,439 @@ class Manager
      *          synchronization.
      *        - A timer event for all configured files that require periodic
      *          synchronization.
+     *        - A monitor for the configuration directory to apply
+     *          the configuration changes at runtime.
      */
     sdbusplus::async::task<> startSyncEvents();
 
+    /**
+     * @brief A helper API to initiate the sync event for the given data based
+     *        on its sync type.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     */
+    void startSyncEvent(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief A helper API to stop the sync event of the given data.
+     *
+     * @param[in] dataSyncCfg - The data sync config to stop syncing
+     */
+    void stopSyncEvent(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief A helper API to switch the sync events once the BMC role or the
+     *        BMC redundancy is changed at runtime.
+     *
+     *        - The full sync in progress is cancelled if the BMC role is
+     *          changed or the redundancy is disabled.
+     *        - The sync events are switched to the new BMC role.
+     *        - The full sync is started once the redundancy is enabled as
+     *          the data is not synced while it is disabled.
+     *
+     * @note Nothing is switched until the sync events are started as they
+     *       are started in the BMC role at that time.
+     */
+    void switchSyncEvents();
+
+    /**
+     * @brief A helper API to switch the sync events to the new BMC role.
+     *
+     *        - The sync plan is switched to the new BMC role.
+     *        - The sync events which are not eligible in the new role are
+     *          stopped.
+     *        - The sync events which are eligible only in the new role are
+     *          started and their data is synced once if it is changed since
+     *          it is confirmed synced, unless the full sync syncs it.
+     *
+     * @param[in] bmcRole - The new BMC role
+     * @param[in] fullSyncStarted - Whether the full sync is started along
+     *                              with the switch
+     */
+    void switchSyncRole(ext_data::BMCRole bmcRole, bool fullSyncStarted);
+
+    /**
+     * @brief A helper API to monitor the new instances of the path templates
+     *        which are not monitored yet.
+     */
+    void startPathTemplateMonitors();
+
+    /**
+     * @brief A helper API to monitor the configuration directory and reload
+     *        the changed configuration files.
+     */
+    sdbusplus::async::task<> monitorConfigDir();
+
+    /**
+     * @brief A helper API to reload the given configuration files and apply
+     *        the configuration changes.
+     *
+     * @param[in] changedFiles - The added, modified, or removed files
+     *
+     * @note The last parsed configurations of the file are kept in use if
+     *       the file fails to parse.
+     */
+    sdbusplus::async::task<>
+        reloadConfiguration(std::set<std::string> changedFiles);
+
+    /**
+     * @brief A helper API to apply the given configuration by comparing it
+     *        with the configuration in use.
+     *
+     *        - The sync events of the unchanged configurations are kept.
+     *        - The sync events of the removed configurations are stopped.
+     *        - The added configurations are synced once and monitored.
+     *        - The reconfigured configurations are monitored again and synced
+     *          once only if the data or its destination is changed.
+     *
+     * @param[in] dataSyncCfgs - The new data sync configuration
+     */
+    void applyConfiguration(std::vector<config::DataSyncConfig> dataSyncCfgs);
+
     /**
      * @brief A helper rsync wrapper API that syncs data to sibling
      *        BMC, with different behavior in the unit test environment,
      *        performing a local copy instead.
      *
      * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] stopToken - The token to cancel the sync, the transfer is
+     *                        killed once it is requested
+     * @param[in] urgent - Whether to transfer at the raised priority
      *
      * @return Returns true if sync succeeds; otherwise, returns false
      *
+     * @note The config is taken by value since the configuration list may
+     *       grow while the sync is in progress.
      */
-    static sdbusplus::async::task<bool>
-        syncData(const config::DataSyncConfig& dataSyncCfg);
+    sdbusplus::async::task<bool> syncData(config::DataSyncConfig dataSyncCfg,
+                                          std::stop_token stopToken = {},
+                                          bool urgent = false);
+
+    /**
+     * @brief A helper API to publish the hit rate of the content index on
+     *        the Statistics interface.
+     */
+    void publishDedupStats();
+
+    /**
+     * @brief A helper API to spawn the transfer process with its standard
+     *        output redirected to the given file descriptor.
+     *
+     * @param[in] syncArgs - The command line of the transfer
+     * @param[in] outputFd - The file descriptor to write the output
+     * @param[in] priority - The scheduling priority of the transfer
+     *
+     * @return The process id, -1 if failed to spawn with the errno set.
+     */
+    static pid_t spawnTransfer(const std::vector<std::string>& syncArgs,
+                               int outputFd,
+                               const transfer::Priority& priority);
+
+    /**
+     * @brief A helper API to read the output of the transfer until it is
+     *        closed without blocking the other syncs.
+     *
+     * @param[in] outputFd - The non blocking file descriptor to read
+     *
+     * @return The output
+     */
+    sdbusplus::async::task<std::string> readTransferOutput(int outputFd);
+
+    /**
+     * @brief A helper API to check whether the sync failed as the sibling
+     *        BMC is unreachable.
+     *
+     * @param[in] exitCode - The exit code of the rsync
+     *
+     * @return True if the sibling BMC is unreachable; otherwise False.
+     */
+    static bool isSiblingUnreachable(int exitCode);
+
+    /**
+     * @brief A helper API to get the number of the bytes transferred by
+     *        the rsync from its statistics.
+     *
+     * @param[in] stats - The output of the rsync with the statistics
+     *
+     * @return The number of the transferred bytes, zero if not found.
+     */
+    static std::uint64_t parseTransferredBytes(std::string_view stats);
+
+    /**
+     * @brief A helper API to get the number of the files transferred by
+     *        the rsync from its statistics.
+     *
+     * @param[in] stats - The output of the rsync with the statistics
+     *
+     * @return The number of the transferred files, zero if not found.
+     */
+    static std::uint64_t parseTransferredFiles(std::string_view stats);
+
+    /**
+     * @brief A helper API to wait until the rate limits of the sync traffic
+     *        allow a new transfer.
+     *
+     * @param[in] stopToken - The token to cancel the wait
+     *
+     * @return True if allowed; otherwise False if cancelled.
+     */
+    sdbusplus::async::task<bool> waitForRateLimit(std::stop_token stopToken);
+
+    /**
+     * @brief A helper API to emit the progress of the full sync once the
+     *        emission interval is elapsed since the last emission, the
+     *        updates meanwhile are coalesced into a single emission.
+     */
+    void scheduleFullSyncProgressEmit();
+
+    /**
+     * @brief A helper API to emit the progress of the full sync after
+     *        the emission interval.
+     */
+    sdbusplus::async::task<> emitFullSyncProgress();
+
+    /**
+     * @brief A helper API to emit the tracked progress of the full sync
+     *        right away.
+     */
+    void publishFullSyncProgress();
+
+    /**
+     * @brief A helper API to queue the changes while the sibling BMC is
+     *        unreachable and replay them once it is reachable.
+     */
+    void siblingUnreachable();
+
+    /**
+     * @brief A helper API to sync the queued changes once the sibling BMC is
+     *        reachable.
+     *
+     *        - The configurations which have the queued changes are synced
+     *          in the order of the sync plan, the immediate ones first.
+     *        - The full sync is performed instead if the queue is overflowed.
+     */
+    sdbusplus::async::task<> replayOfflineChanges();
+
+    /**
+     * @brief A helper API to log the data changed while the daemon is down,
+     *        by the fingerprints of the data when it is stopped.
+     *
+     * @return True if the changes are known; otherwise False if the daemon
+     *         is not stopped gracefully.
+     */
+    sdbusplus::async::task<bool> recordOfflineChanges();
+
+    /**
+     * @brief A helper API to sync the configurations which have the pending
+     *        changes in the tier order, and in the order of the sync plan
+     *        within a tier.
+     *
+     * @return The number of the synced configurations.
+     *
+     * @note It stops once the sibling BMC is unreachable.
+     */
+    sdbusplus::async::task<std::size_t> syncPendingChanges();
+
+    /**
+     * @brief A helper API to log and journal the change of the given path.
+     *
+     * @param[in] path - The changed path
+     * @param[in] isDir - Whether the changed path is a directory, it is
+     *                    logged with the trailing separator to cover the
+     *                    changes under it
+     */
+    void recordChange(const std::string& path, bool isDir = false);
+
+    /**
+     * @brief A helper API to confirm and journal the changes of the given
+     *        configured path up to the given sequence are synced.
+     *
+     * @param[in] cfgPath - The configured path
+     * @param[in] sequence - The last sequence covered by the sync
+     */
+    void confirmChanges(const std::string& cfgPath,
+                        ChangeLog::Sequence sequence);
+
+    /**
+     * @brief A helper API to commit the journal once the records journaled
+     *        meanwhile are grouped.
+     */
+    void scheduleJournalCommit();
+
+    /**
+     * @brief A helper API to commit or compact the journal after the group
+     *        commit interval.
+     */
+    sdbusplus::async::task<> commitJournal();
+
+    /**
+     * @brief A helper API to run the given job walking or hashing the data
+     *        on a worker at the priority of the transfers, as it is the
+     *        background work of the sync like them.
+     *
+     * @param[in] job - The job to run
+     * @param[in] urgent - Whether to run at the priority of the urgent
+     *                     transfers
+     *
+     * @return The result of the job.
+     */
+    template <typename Job>
+    auto runInTransferWorker(Job job, bool urgent = false)
+    {
+        const auto& priority = urgent ? _urgentTransferPriority
+                                      : _transferPriority;
+        return runInWorker(_ctx, [&priority, job = std::move(job)]() mutable {
+            transfer::applyThreadPriority(priority);
+            return job();
+        });
+    }
+
+    /**
+     * @brief A helper API to get the fingerprint of the parsed configuration
+     *        files to detect the configuration changes across the restarts.
+     *
+     * @return The fingerprint
+     */
+    std::uint64_t configFingerprint() const;
+
+    /**
+     * @brief A helper API to get the fingerprint of the given source data
+     *        from the size and the modification time of it and the entries
+     *        under it.
+     *
+     * @param[in] path - The source data path
+     *
+     * @return The fingerprint
+     *
+     * @note It walks the data, hence it is run in a worker unless the event
+     *       loop is stopped.
+     */
+    static std::uint64_t sourceFingerprint(const std::string& path);
+
+    /**
+     * @brief A helper API to sync the given data and confirm the logged
+     *        changes of it once synced.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] stopToken - The token to cancel the sync
+     * @param[in] urgent - Whether to transfer at the raised priority
+     * @param[in] fingerprint - The fingerprint of the source data taken
+     *                          before syncing, it is taken here if not given
+     *
+     * @return Returns true if sync succeeds; otherwise, returns false
+     */
+    sdbusplus::async::task<bool> syncChangedData(
+        config::DataSyncConfig dataSyncCfg, std::stop_token stopToken = {},
+        bool urgent = false,
+        std::optional<std::uint64_t> fingerprint = std::nullopt);
+
+    /**
+     * @brief A helper API to queue the sync of the changed data by its
+     *        deadline.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     */
+    void scheduleSync(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief A helper API to start the queued syncs of the earliest deadlines
+     *        as long as the concurrent syncs are under the limit.
+     */
+    void dispatchSyncs();
+
+    /**
+     * @brief A helper API to run the given queued sync and dispatch the next
+     *        ones once it is finished.
+     *
+     * @param[in] job - The queued sync to run
+     */
+    sdbusplus::async::task<> runScheduledSync(SyncScheduler::Job job);
+
+    /**
+     * @brief A helper API to get the configurations of the sync plan in the
+     *        given scope in the order of the plan.
+     *
+     * @param[in] scope - The scope of the full sync
+     *
+     * @return The indices of the configurations in the scope.
+     */
+    std::vector<std::size_t> fullSyncCfgs(const FullSyncScope& scope);
+
+    /**
+     * @brief A helper API to sync the data which is changed since it is
+     *        confirmed synced once the BMC role is switched.
+     *
+     * @param[in] dataSyncCfgs - The data sync configs which are eligible
+     *                           only in the new role
+     */
+    sdbusplus::async::task<>
+        resyncChangedData(std::vector<config::DataSyncConfig> dataSyncCfgs);
 
     /**
      * @brief A helper to API to monitor data to sync if its changed
      *
      * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] stopToken - The token to stop monitoring
      *
      */
     sdbusplus::async::task<>
-        monitorDataToSync(const config::DataSyncConfig& dataSyncCfg);
+        monitorDataToSync(config::DataSyncConfig dataSyncCfg,
+                          std::stop_token stopToken);
 
     /**
      * @brief A helper to API to sync data periodically.
      *
      * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] stopToken - The token to stop syncing
      */
     sdbusplus::async::task<>
-        monitorTimerToSync(const config::DataSyncConfig& dataSyncCfg);
+        monitorTimerToSync(config::DataSyncConfig dataSyncCfg,
+                           std::stop_token stopToken);
+
+    /**
+     * @brief A helper API to monitor the parent directory of the path
+     *        template to expand the newly created instances and to drop the
+     *        removed ones.
+     *
+     * @param[in] pathTemplate - The path template to monitor
+     * @param[in] stopToken - The token to stop monitoring
+     */
+    sdbusplus::async::task<>
+        monitorPathTemplate(std::shared_ptr<config::PathTemplate> pathTemplate,
+                            std::stop_token stopToken);
+
+    /**
+     * @brief A helper API to add the newly expanded instance of the path
+     *        template and start its synchronization.
+     *
+     * @param[in] dataSyncCfg - The data sync config of the new instance
+     */
+    sdbusplus::async::task<>
+        startExpandedDataSync(config::DataSyncConfig dataSyncCfg);
+
+    /**
+     * @brief A helper API to stop the synchronization of the removed
+     *        instance of the path template and drop its configuration.
+     *
+     * @param[in] dataSyncCfg - The data sync config of the removed instance
+     */
+    void stopExpandedDataSync(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief A helper API to start the synchronization of the data which is
+     *        added after the full sync.
+     *
+     * @param[in] dataSyncCfg - The data sync config of the added data
+     */
+    sdbusplus::async::task<>
+        startAddedDataSync(config::DataSyncConfig dataSyncCfg);
 
     /**
      * @brief A helper to API Checks if the data can be synchronize.
      *
      *        - This API verifies whether the given data meets the criteria
-     *          for being synced. It returns a boolean value indicating if
-     *          the data is eligible to be synced.
+     *          for being synced in the current BMC role. It returns a boolean
+     *          value indicating if the data is eligible to be synced.
      *
      * @param[in] dataSyncCfg - The data sync config to sync
      *
@@ -154,6 +800,14 @@ class Manager
      */
     bool isSyncEligible(const config::DataSyncConfig& dataSyncCfg);
 
+    /**
+     * @brief A helper API to get the sync plan of the current BMC role.
+     *
+     * @return The sync plan, it is rebuilt only if the configuration or
+     *         the BMC role is changed since it is planned.
+     */
+    const SyncPlan& syncPlan();
+
     /**
      * @brief The async context object used to perform operations asynchronously
      *        as required.
@@ -170,15 +824,203 @@ class Manager
      * @brief The data sync configuration directory
      */
     std::string _dataSyncCfgDir;
+
+    /**
+     * @brief The directory to persist the data sync data
+     */
+    fs::path _dataSyncPersistDir;
+
     /**
      * @brief The list of data to synchronize.
      */
-    std::vector<config::DataSyncConfig> _dataSyncConfiguration;
+    config::ConfigStore _dataSyncConfiguration;
+
+    /**
+     * @brief The eligible configurations to sync in the current BMC role,
+     *        reset once the configuration is changed.
+     */
+    std::optional<SyncPlan> _syncPlan;
+
+    /**
+     * @brief The BMC role in which the sync events are running, unset until
+     *        the sync events are started.
+     */
+    std::optional<ext_data::BMCRole> _syncEventsRole;
+
+    /**
+     * @brief The BMC redundancy with which the data is synced, unset until
+     *        the initial full sync is decided, to start the full sync once
+     *        it is enabled at runtime.
+     */
+    std::optional<bool> _syncRedundancy;
+
+    /**
+     * @brief The fingerprint of the source data of each configured path when
+     *        it is synced last time, journaled once the daemon is stopped.
+     */
+    std::map<std::string, std::uint64_t, std::less<>> _sourceFingerprints;
+
+    /**
+     * @brief The log of the changed data which is not confirmed synced yet,
+     *        it queues the changes while the sibling BMC is unreachable.
+     */
+    ChangeLog _changeLog;
+
+    /**
+     * @brief The journal of the change log to restore the pending changes
+     *        after the restart.
+     */
+    ChangeJournal _changeJournal;
+
+    /**
+     * @brief The progress of the last full sync.
+     */
+    FullSyncProgressTracker _fullSyncProgress;
+
+    /**
+     * @brief The queue of the changed data to sync by the deadlines.
+     */
+    SyncScheduler _syncScheduler;
+
+    /**
+     * @brief The global rate limit of the bytes of the sync traffic.
+     */
+    TokenBucket _byteRateLimit;
+
+    /**
+     * @brief The global rate limit of the files of the sync traffic.
+     */
+    TokenBucket _fileRateLimit;
+
+    /**
+     * @brief The scheduling priority of the transfers.
+     */
+    transfer::Priority _transferPriority;
+
+    /**
+     * @brief The scheduling priority of the urgent transfers.
+     */
+    transfer::Priority _urgentTransferPriority;
+
+    /**
+     * @brief The policy to decide the compression of the transfers.
+     */
+    CompressionPolicy _compressionPolicy;
+
+    /**
+     * @brief The index of the content of the synced files to select the
+     *        basis of the transfers.
+     */
+    ChunkIndex _chunkIndex;
+
+    /**
+     * @brief Whether the progress emission of the full sync is scheduled.
+     */
+    bool _fullSyncProgressEmitPending{false};
+
+    /**
+     * @brief The source to cancel the full sync in progress.
+     */
+    std::stop_source _fullSyncStop;
+
+    /**
+     * @brief The BMC role in which the last full sync is started, it is
+     *        cancelled once the role is changed.
+     */
+    ext_data::BMCRole _fullSyncRole{ext_data::BMCRole::Unknown};
+
+    /**
+     * @brief Whether the journal commit is scheduled.
+     */
+    bool _journalCommitPending{false};
+
+    /**
+     * @brief Whether the sibling BMC is reachable to sync.
+     */
+    bool _siblingReachable{true};
+
+    /**
+     * @brief The structure contains the parsed configurations of
+     *        a configuration file.
+     */
+    struct ConfigFile
+    {
+        /**
+         * @brief The details of the file when it is parsed.
+         */
+        config::SourceFile _sourceFile;
+
+        /**
+         * @brief The parsed configurations.
+         */
+        std::vector<config::DataSyncConfig> _dataSyncCfgs;
+    };
+
+    /**
+     * @brief The structure contains a path template and the stop source to
+     *        stop its monitor.
+     */
+    struct PathTemplateMonitor
+    {
+        /**
+         * @brief The path template.
+         *
+         * @note It is shared with the monitoring task as the template may be
+         *       removed while the task is suspended.
+         */
+        std::shared_ptr<config::PathTemplate> _pathTemplate;
+
+        /**
+         * @brief The stop source of the monitor.
+         */
+        std::stop_source _stopSource;
+
+        /**
+         * @brief Whether the monitor is started.
+         */
+        bool _monitored{false};
+    };
+
+    /**
+     * @brief The parsed configuration files, keyed by the file path.
+     */
+    std::map<std::string, ConfigFile> _configFiles;
+
+    /**
+     * @brief The configuration files which failed to parse.
+     */
+    std::set<std::string> _unparsedConfigFiles;
+
+    /**
+     * @brief The stop source of the sync event of each configuration.
+     */
+    std::vector<std::pair<config::DataSyncConfig, std::stop_source>>
+        _syncEvents;
+
+    /**
+     * @brief The list of configured path templates.
+     */
+    std::vector<PathTemplateMonitor> _pathTemplates;
 
     /**
      * @brief SyncBMCData Server Interface object
      */
     dbus_ifaces::SyncBMCDataIface _syncBMCDataIface;
+
+    /**
+     * @brief FullSync Server Interface object
+     */
+    dbus_ifaces::FullSyncIface _fullSyncIface;
+
+    /**
+     * @brief RateLimit Server Interface object
+     */
+    dbus_ifaces::RateLimitIface _rateLimitIface;
+
+    /**
+     * @brief Statistics Server Interface object
+     */
+    dbus_ifaces::StatisticsIface _statisticsIface;
 };
 
 } // namespace data_sync
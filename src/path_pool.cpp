@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "path_pool.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace data_sync::config
+{
+
+namespace
+{
+
+/**
+ * @brief The empty slot of the open addressing tables.
+ */
+constexpr std::uint32_t emptySlot = std::numeric_limits<std::uint32_t>::max();
+
+// The lookups return the empty slot as is if not found.
+static_assert(emptySlot == PathPool::noPath);
+
+/**
+ * @brief Visit the components of the given path split by the separator.
+ *
+ * @param[in] path - The path to split
+ * @param[in] visit - The visitor of each component
+ */
+template <typename Visitor>
+void forEachComponent(std::string_view path, Visitor visit)
+{
+    std::size_t start = 0;
+    while (true)
+    {
+        auto end = path.find('/', start);
+        visit(path.substr(start, end - start));
+        if (end == std::string_view::npos)
+        {
+            return;
+        }
+        start = end + 1;
+    }
+}
+
+/**
+ * @brief Get the hash of the given path node.
+ *
+ * @param[in] parent - The id of the parent path
+ * @param[in] componentId - The id of the last component
+ *
+ * @return The hash
+ */
+std::size_t nodeHash(std::uint32_t parent, std::uint32_t componentId)
+{
+    // Mix the bits as the ids are sequential and the table is indexed by
+    // the low bits.
+    auto key = (static_cast<std::uint64_t>(parent) << 32) | componentId;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return static_cast<std::size_t>(key);
+}
+
+/**
+ * @brief Get the hash of the given component.
+ *
+ * @param[in] comp - The component
+ *
+ * @return The hash
+ */
+std::size_t componentHash(std::string_view comp)
+{
+    return std::hash<std::string_view>{}(comp);
+}
+
+/**
+ * @brief Find the slot of the id which matches or the empty slot to insert
+ *        the id.
+ *
+ * @param[in] slots - The open addressing table, it must not be empty
+ * @param[in] hash - The hash to find
+ * @param[in] match - Checks whether the given id matches
+ *
+ * @return The slot
+ */
+template <typename Match>
+std::size_t probe(const std::vector<std::uint32_t>& slots, std::size_t hash,
+                  Match match)
+{
+    auto mask = slots.size() - 1;
+    for (auto slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        if (slots[slot] == emptySlot || match(slots[slot]))
+        {
+            return slot;
+        }
+    }
+}
+
+/**
+ * @brief Grow the open addressing table to keep the load factor under
+ *        a half for the short probes.
+ *
+ * @param[in,out] slots - The open addressing table
+ * @param[in] count - The number of the ids in the table
+ * @param[in] hashOf - Gets the hash of the given id
+ */
+template <typename HashOf>
+void reserveSlot(std::vector<std::uint32_t>& slots, std::size_t count,
+                 HashOf hashOf)
+{
+    if ((count + 1) * 2 <= slots.size())
+    {
+        return;
+    }
+
+    std::vector<std::uint32_t> newSlots(std::max<std::size_t>(slots.size() * 2,
+                                                              16),
+                                        emptySlot);
+    for (auto id : slots)
+    {
+        if (id != emptySlot)
+        {
+            newSlots[probe(newSlots, hashOf(id),
+                           [](std::uint32_t) { return false; })] = id;
+        }
+    }
+    slots = std::move(newSlots);
+}
+
+} // namespace
+
+PathPool::PathId PathPool::intern(std::string_view path)
+{
+    PathId pathId = noPath;
+    forEachComponent(path, [this, &pathId](std::string_view comp) {
+        auto componentId = findComponent(comp);
+        if (componentId == noPath)
+        {
+            reserveSlot(_componentSlots, _components.size(),
+                        [this](std::uint32_t id) {
+                return componentHash(component(id));
+            });
+            componentId = static_cast<std::uint32_t>(_components.size());
+            _components.push_back(
+                {static_cast<std::uint32_t>(_chars.size()),
+                 static_cast<std::uint32_t>(comp.size())});
+            _chars.append(comp);
+            _componentSlots[probe(_componentSlots, componentHash(comp),
+                                  [](std::uint32_t) { return false; })] =
+                componentId;
+        }
+
+        auto nodeId = findNode(pathId, componentId);
+        if (nodeId == noPath)
+        {
+            reserveSlot(_nodeSlots, _nodes.size(), [this](std::uint32_t id) {
+                return nodeHash(_nodes[id]._parent, _nodes[id]._component);
+            });
+            nodeId = static_cast<PathId>(_nodes.size());
+            _nodes.push_back({pathId, componentId});
+            _nodeSlots[probe(_nodeSlots, nodeHash(pathId, componentId),
+                             [](std::uint32_t) { return false; })] = nodeId;
+        }
+        pathId = nodeId;
+    });
+    return pathId;
+}
+
+PathPool::PathId PathPool::find(std::string_view path) const
+{
+    PathId pathId = noPath;
+    bool found = true;
+    forEachComponent(path, [this, &pathId, &found](std::string_view comp) {
+        if (!found)
+        {
+            return;
+        }
+        auto componentId = findComponent(comp);
+        pathId = componentId == noPath ? noPath : findNode(pathId, componentId);
+        found = pathId != noPath;
+    });
+    return found ? pathId : noPath;
+}
+
+std::string PathPool::path(PathId pathId) const
+{
+    std::vector<std::uint32_t> componentIds;
+    std::size_t length = 0;
+    for (auto nodeId = pathId; nodeId != noPath;
+         nodeId = _nodes[nodeId]._parent)
+    {
+        componentIds.push_back(_nodes[nodeId]._component);
+        length += _components[_nodes[nodeId]._component]._length + 1;
+    }
+
+    std::string path;
+    path.reserve(length);
+    for (auto componentId = componentIds.rbegin();
+         componentId != componentIds.rend(); ++componentId)
+    {
+        if (componentId != componentIds.rbegin())
+        {
+            path.push_back('/');
+        }
+        path.append(component(*componentId));
+    }
+    return path;
+}
+
+void PathPool::shrinkToFit()
+{
+    _chars.shrink_to_fit();
+    _components.shrink_to_fit();
+    _nodes.shrink_to_fit();
+}
+
+std::uint32_t PathPool::findComponent(std::string_view comp) const
+{
+    if (_componentSlots.empty())
+    {
+        return noPath;
+    }
+    return _componentSlots[probe(_componentSlots, componentHash(comp),
+                                 [this, comp](std::uint32_t id) {
+        return component(id) == comp;
+    })];
+}
+
+PathPool::PathId PathPool::findNode(PathId parent,
+                                    std::uint32_t componentId) const
+{
+    if (_nodeSlots.empty())
+    {
+        return noPath;
+    }
+    return _nodeSlots[probe(_nodeSlots, nodeHash(parent, componentId),
+                            [this, parent, componentId](std::uint32_t id) {
+        return _nodes[id]._parent == parent &&
+               _nodes[id]._component == componentId;
+    })];
+}
+
+} // namespace data_sync::config
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace data_sync::config
+{
+
+/**
+ * @class PathPool
+ *
+ * @brief The class interns the paths into a prefix sharing path table so
+ *        that the common parent directories of the configured paths are
+ *        stored only once.
+ *
+ *        - A path is split by the separator into the components and each
+ *          path is stored as its parent path and its last component, hence
+ *          a path costs a few bytes once its parent is interned.
+ *        - The components are interned into a single character buffer.
+ *        - The components and the paths are looked up by open addressing
+ *          tables of the ids to not allocate per entry.
+ *        - The path is restored exactly as interned, including the repeated
+ *          and the trailing separators.
+ */
+class PathPool
+{
+  public:
+    /**
+     * @brief The id of an interned path.
+     */
+    using PathId = std::uint32_t;
+
+    /**
+     * @brief The id which refers to no path.
+     */
+    static constexpr PathId noPath = std::numeric_limits<PathId>::max();
+
+    /**
+     * @brief Intern the given path.
+     *
+     * @param[in] path - The path to intern
+     *
+     * @return The id of the path, the same path always gets the same id.
+     */
+    PathId intern(std::string_view path);
+
+    /**
+     * @brief Find the id of the given path without interning it.
+     *
+     * @param[in] path - The path to find
+     *
+     * @return The id of the path if interned; otherwise, noPath.
+     */
+    PathId find(std::string_view path) const;
+
+    /**
+     * @brief Get the path of the given id.
+     *
+     * @param[in] pathId - The id of the path
+     *
+     * @return The path
+     */
+    std::string path(PathId pathId) const;
+
+    /**
+     * @brief Release the unused capacity once the paths are interned.
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief Get the number of the interned paths including the parent
+     *        paths, the ids are less than this number.
+     */
+    std::size_t size() const
+    {
+        return _nodes.size();
+    }
+
+  private:
+    /**
+     * @brief The structure represents an interned path by its parent path
+     *        and its last component.
+     */
+    struct Node
+    {
+        /**
+         * @brief The id of the parent path, noPath for the first component.
+         */
+        PathId _parent;
+
+        /**
+         * @brief The id of the last component.
+         */
+        std::uint32_t _component;
+    };
+
+    /**
+     * @brief The structure represents an interned component in the
+     *        character buffer.
+     */
+    struct Component
+    {
+        /**
+         * @brief The offset of the component in the character buffer.
+         */
+        std::uint32_t _offset;
+
+        /**
+         * @brief The length of the component.
+         */
+        std::uint32_t _length;
+    };
+
+    /**
+     * @brief Get the text of the given component.
+     *
+     * @param[in] componentId - The id of the component
+     *
+     * @return The component
+     */
+    std::string_view component(std::uint32_t componentId) const
+    {
+        const auto& comp = _components[componentId];
+        return std::string_view{_chars}.substr(comp._offset, comp._length);
+    }
+
+    /**
+     * @brief A helper API to find the id of the given component.
+     *
+     * @param[in] comp - The component to find
+     *
+     * @return The id of the component if interned; otherwise, noPath.
+     */
+    std::uint32_t findComponent(std::string_view comp) const;
+
+    /**
+     * @brief A helper API to find the id of the given path node.
+     *
+     * @param[in] parent - The id of the parent path
+     * @param[in] componentId - The id of the last component
+     *
+     * @return The id of the path if interned; otherwise, noPath.
+     */
+    PathId findNode(PathId parent, std::uint32_t componentId) const;
+
+    /**
+     * @brief The characters of all the interned components.
+     */
+    std::string _chars;
+
+    /**
+     * @brief The interned components.
+     */
+    std::vector<Component> _components;
+
+    /**
+     * @brief The open addressing table of the component ids.
+     */
+    std::vector<std::uint32_t> _componentSlots;
+
+    /**
+     * @brief The interned paths.
+     */
+    std::vector<Node> _nodes;
+
+    /**
+     * @brief The open addressing table of the path ids.
+     */
+    std::vector<PathId> _nodeSlots;
+};
+
+} // namespace data_sync::config
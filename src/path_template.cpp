@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "path_template.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+namespace data_sync::config
+{
+
+namespace
+{
+
+/**
+ * @brief A helper API to replace all the placeholders in the given string
+ *        with the given instance.
+ */
+std::string replacePlaceholder(std::string str, const std::string& instance)
+{
+    for (auto pos = str.find(PathTemplate::placeholder);
+         pos != std::string::npos;
+         pos = str.find(PathTemplate::placeholder, pos + instance.size()))
+    {
+        str.replace(pos, PathTemplate::placeholder.size(), instance);
+    }
+    return str;
+}
+
+} // namespace
+
+PathTemplate::PathTemplate(const DataSyncConfig& templateCfg) :
+    _templateCfg(templateCfg)
+{
+    const std::string& path = _templateCfg._path;
+    auto placeholderPos = path.find(placeholder);
+    auto componentStart = path.rfind('/', placeholderPos);
+    if (placeholderPos == std::string::npos ||
+        componentStart == std::string::npos)
+    {
+        throw std::invalid_argument("The path [" + path +
+                                    "] is not a valid path template");
+    }
+
+    auto componentEnd = path.find('/', placeholderPos);
+    std::string component = path.substr(componentStart + 1,
+                                        componentEnd == std::string::npos
+                                            ? std::string::npos
+                                            : componentEnd - componentStart -
+                                                  1);
+
+    _parentDir = componentStart == 0 ? fs::path("/")
+                                     : fs::path(path.substr(0, componentStart));
+    _prefix = component.substr(0, placeholderPos - componentStart - 1);
+    _suffix = component.substr(_prefix.size() + placeholder.size());
+
+    if (isTemplate(_suffix))
+    {
+        throw std::invalid_argument(
+            "The path [" + path +
+            "] contains more than one placeholder in a path component");
+    }
+}
+
+std::optional<std::string>
+    PathTemplate::matchInstance(std::string_view entryName) const
+{
+    if (entryName.size() <= _prefix.size() + _suffix.size() ||
+        !entryName.starts_with(_prefix) || !entryName.ends_with(_suffix))
+    {
+        return std::nullopt;
+    }
+
+    auto instance = entryName.substr(_prefix.size(), entryName.size() -
+                                                         _prefix.size() -
+                                                         _suffix.size());
+    if (!std::ranges::all_of(instance,
+                             [](char c) { return c >= '0' && c <= '9'; }) ||
+        (instance.size() > 1 && instance.front() == '0'))
+    {
+        return std::nullopt;
+    }
+    return std::string(instance);
+}
+
+DataSyncConfig PathTemplate::makeInstanceCfg(const std::string& instance) const
+{
+    DataSyncConfig dataSyncCfg{_templateCfg};
+    dataSyncCfg._path = replacePlaceholder(dataSyncCfg._path, instance);
+    if (dataSyncCfg._destPath.has_value())
+    {
+        dataSyncCfg._destPath = replacePlaceholder(*dataSyncCfg._destPath,
+                                                   instance);
+    }
+
+    auto replaceInList = [&instance](auto& fileList) {
+        if (fileList.has_value())
+        {
+            std::ranges::for_each(*fileList, [&instance](auto& path) {
+                path = replacePlaceholder(path, instance);
+            });
+        }
+    };
+    replaceInList(dataSyncCfg._excludeFileList);
+    replaceInList(dataSyncCfg._includeFileList);
+
+    return dataSyncCfg;
+}
+
+std::optional<DataSyncConfig>
+    PathTemplate::instantiate(const std::string& instance)
+{
+    if (!_expandedInstances.insert(instance).second)
+    {
+        return std::nullopt;
+    }
+    return makeInstanceCfg(instance);
+}
+
+std::vector<DataSyncConfig> PathTemplate::instances() const
+{
+    std::vector<DataSyncConfig> dataSyncCfgs;
+    dataSyncCfgs.reserve(_expandedInstances.size());
+    std::ranges::transform(_expandedInstances,
+                           std::back_inserter(dataSyncCfgs),
+                           [this](const auto& instance) {
+        return makeInstanceCfg(instance);
+    });
+    return dataSyncCfgs;
+}
+
+std::vector<DataSyncConfig> PathTemplate::expand()
+{
+    std::vector<DataSyncConfig> dataSyncCfgs;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(_parentDir, ec))
+    {
+        if (auto dataSyncCfg = expandEntry(entry.path().filename().string());
+            dataSyncCfg.has_value())
+        {
+            dataSyncCfgs.emplace_back(std::move(*dataSyncCfg));
+        }
+    }
+
+    if (ec)
+    {
+        lg2::debug("Unable to expand the path template [{PATH}], "
+                   "error: {ERROR}",
+                   "PATH", _templateCfg._path, "ERROR", ec.message());
+    }
+
+    return dataSyncCfgs;
+}
+
+std::vector<DataSyncConfig> PathTemplate::expand(std::size_t hostInstances)
+{
+    std::vector<DataSyncConfig> dataSyncCfgs;
+
+    for (std::size_t instance = 0; instance < hostInstances; ++instance)
+    {
+        if (auto dataSyncCfg = instantiate(std::to_string(instance));
+            dataSyncCfg.has_value())
+        {
+            dataSyncCfgs.emplace_back(std::move(*dataSyncCfg));
+        }
+    }
+
+    return dataSyncCfgs;
+}
+
+std::optional<DataSyncConfig>
+    PathTemplate::expandEntry(std::string_view entryName)
+{
+    auto instance = matchInstance(entryName);
+    if (!instance.has_value())
+    {
+        return std::nullopt;
+    }
+    return instantiate(*instance);
+}
+
+std::optional<DataSyncConfig>
+    PathTemplate::removeEntry(std::string_view entryName)
+{
+    auto instance = matchInstance(entryName);
+    if (!instance.has_value() || _expandedInstances.erase(*instance) == 0)
+    {
+        return std::nullopt;
+    }
+    return makeInstanceCfg(*instance);
+}
+
+} // namespace data_sync::config
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace data_sync::config
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class PathTemplate
+ *
+ * @brief The class expands the data sync configuration whose path contains
+ *        the "{}" placeholder (for example, the per host instance data like
+ *        "/var/lib/phosphor-state-manager/host{}-PersistData") into the
+ *        concrete data sync configurations.
+ *
+ *        - The placeholder must be within a single path component, which is
+ *          matched against the entries of its parent directory.
+ *        - The placeholder stands for the host instance number, hence it
+ *          matches only a decimal number without the leading zeros.
+ *        - The same instance replaces the placeholder in the destination path
+ *          and in the include and exclude file lists.
+ *        - The expanded instances are cached so that only the newly appeared
+ *          instances are returned on subsequent expansions.
+ */
+class PathTemplate
+{
+  public:
+    /**
+     * @brief The placeholder used in the configured path.
+     */
+    static constexpr std::string_view placeholder{"{}"};
+
+    /**
+     * @brief The constructor
+     *
+     * @param[in] templateCfg - The data sync config which contains
+     *                          the placeholder in its path.
+     *
+     * @throw std::invalid_argument if the path doesn't contain a valid
+     *        placeholder.
+     */
+    explicit PathTemplate(const DataSyncConfig& templateCfg);
+
+    /**
+     * @brief An API helper to check whether the given path contains the
+     *        placeholder.
+     *
+     * @param[in] path - The path to check
+     *
+     * @return True if the path is a template; otherwise False.
+     */
+    static bool isTemplate(std::string_view path)
+    {
+        return path.find(placeholder) != std::string_view::npos;
+    }
+
+    /**
+     * @brief Expand the template against the entries of the parent directory
+     *        in the filesystem.
+     *
+     * @return The data sync configurations of the instances which are not
+     *         expanded so far.
+     */
+    std::vector<DataSyncConfig> expand();
+
+    /**
+     * @brief Expand the template against the given host instance count
+     *        i.e. the placeholder is replaced with 0 to hostInstances - 1.
+     *
+     * @param[in] hostInstances - The number of host instances
+     *
+     * @return The data sync configurations of the instances which are not
+     *         expanded so far.
+     */
+    std::vector<DataSyncConfig> expand(std::size_t hostInstances);
+
+    /**
+     * @brief Expand the template for the given entry of the parent directory,
+     *        used when the parent directory reports a new entry to avoid
+     *        rescanning the whole directory.
+     *
+     * @param[in] entryName - The name of the entry in the parent directory
+     *
+     * @return The data sync configuration if the entry matches the template
+     *         and is not expanded so far; otherwise, nullopt.
+     */
+    std::optional<DataSyncConfig> expandEntry(std::string_view entryName);
+
+    /**
+     * @brief Drop the instance of the given entry of the parent directory,
+     *        used when the parent directory reports a removed entry.
+     *
+     * @param[in] entryName - The name of the entry in the parent directory
+     *
+     * @return The data sync configuration of the dropped instance if the
+     *         entry is expanded so far; otherwise, nullopt.
+     */
+    std::optional<DataSyncConfig> removeEntry(std::string_view entryName);
+
+    /**
+     * @brief Get the data sync configurations of all the instances which are
+     *        expanded so far.
+     *
+     * @return The data sync configurations of the expanded instances.
+     */
+    std::vector<DataSyncConfig> instances() const;
+
+    /**
+     * @brief Get the directory to watch for the new instances.
+     */
+    const fs::path& parentDir() const
+    {
+        return _parentDir;
+    }
+
+    /**
+     * @brief Get the data sync config which contains the placeholder.
+     */
+    const DataSyncConfig& templateCfg() const
+    {
+        return _templateCfg;
+    }
+
+  private:
+    /**
+     * @brief A helper API to retrieve the instance from the given entry name
+     *        of the parent directory.
+     *
+     * @param[in] entryName - The name of the entry in the parent directory
+     *
+     * @return The instance if the entry matches; otherwise, nullopt.
+     */
+    std::optional<std::string> matchInstance(std::string_view entryName) const;
+
+    /**
+     * @brief A helper API to create the data sync config for the given
+     *        instance.
+     *
+     * @param[in] instance - The instance to replace the placeholder
+     *
+     * @return The data sync configuration of the instance.
+     */
+    DataSyncConfig makeInstanceCfg(const std::string& instance) const;
+
+    /**
+     * @brief A helper API to create the data sync config for the given
+     *        instance if it is not expanded so far.
+     *
+     * @param[in] instance - The instance to replace the placeholder
+     *
+     * @return The data sync config on success; otherwise, nullopt.
+     */
+    std::optional<DataSyncConfig> instantiate(const std::string& instance);
+
+    /**
+     * @brief The data sync config which contains the placeholder.
+     */
+    DataSyncConfig _templateCfg;
+
+    /**
+     * @brief The parent directory of the path component which contains
+     *        the placeholder.
+     */
+    fs::path _parentDir;
+
+    /**
+     * @brief The part of the templated path component before
+     *        the placeholder.
+     */
+    std::string _prefix;
+
+    /**
+     * @brief The part of the templated path component after
+     *        the placeholder.
+     */
+    std::string _suffix;
+
+    /**
+     * @brief The instances expanded so far.
+     */
+    std::set<std::string> _expandedInstances;
+};
+
+} // namespace data_sync::config
@@ -20,7 +20,7 @@ int main()
 
     data_sync::Manager manager{
         ctx, std::make_unique<data_sync::ext_data::ExternalDataIFacesImpl>(ctx),
-        DATA_SYNC_CONFIG_DIR};
+        DATA_SYNC_CONFIG_DIR, DATA_SYNC_PERSIST_DIR};
 
     // clang-tidy currently mangles this into something unreadable
     // NOLINTNEXTLINE
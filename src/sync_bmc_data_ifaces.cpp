@@ -3,8 +3,10 @@
 #include "sync_bmc_data_ifaces.hpp"
 
 #include "manager.hpp"
+#include "token_bucket.hpp"
 
 #include <phosphor-logging/lg2.hpp>
+#include <xyz/openbmc_project/Common/error.hpp>
 
 namespace data_sync::dbus_ifaces
 {
@@ -44,4 +46,168 @@ sdbusplus::async::task<>
     co_return _ctx.spawn(_manager.startFullSync());
 }
 
+FullSyncIface::FullSyncIface(sdbusplus::async::context& ctx,
+                             data_sync::Manager& manager) :
+    sdbusplus::aserver::xyz::openbmc_project::control::sync_bmc_data::FullSync<
+        FullSyncIface>(ctx, SyncBMCData::instance_path),
+    _manager(manager), _ctx(ctx)
+{
+    emit_added();
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    FullSyncIface::method_call([[maybe_unused]] cancel_t type)
+{
+    if (!_manager.cancelFullSync())
+    {
+        lg2::error("No Full Sync in progress to cancel");
+        throw sdbusplus::xyz::openbmc_project::Common::Error::Unavailable();
+    }
+    co_return;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    FullSyncIface::method_call([[maybe_unused]] start_scoped_t type,
+                               std::string pathPrefix, std::string configFile)
+{
+    if (pathPrefix.empty() && configFile.empty())
+    {
+        lg2::error("Neither the path prefix nor the config file is given to "
+                   "scope the Full Sync");
+        throw sdbusplus::xyz::openbmc_project::Common::Error::
+            InvalidArgument();
+    }
+
+    if (!configFile.empty() && !_manager.containsConfigFile(configFile))
+    {
+        lg2::error("Unknown config file to scope the Full Sync: {FILE}",
+                   "FILE", configFile);
+        throw sdbusplus::xyz::openbmc_project::Common::Error::
+            InvalidArgument();
+    }
+
+    if (_manager.isSiblingBmcNotAvailable())
+    {
+        lg2::error(
+            "Sibling BMC is not available, Unable to retrieve the BMC IP ");
+        throw sdbusplus::xyz::openbmc_project::Control::SyncBMCData::Error::
+            SiblingBMCNotAvailable();
+    }
+
+    if (_manager.getFullSyncStatus() ==
+        SyncBMCData::FullSyncStatus::FullSyncInProgress)
+    {
+        lg2::error(
+            "Full Sync in progress. Operation cannot proceed at this time ");
+        throw sdbusplus::xyz::openbmc_project::Control::SyncBMCData::Error::
+            FullSyncInProgress();
+    }
+
+    FullSyncScope scope;
+    if (!pathPrefix.empty())
+    {
+        scope._pathPrefix = std::move(pathPrefix);
+    }
+    if (!configFile.empty())
+    {
+        scope._configFile = std::move(configFile);
+    }
+    co_return _ctx.spawn(_manager.startFullSync(std::move(scope)));
+}
+
+RateLimitIface::RateLimitIface(sdbusplus::async::context& ctx,
+                               data_sync::Manager& manager,
+                               std::uint64_t bandwidthLimit,
+                               std::uint64_t fileRateLimit,
+                               std::chrono::seconds burst) :
+    sdbusplus::aserver::xyz::openbmc_project::control::sync_bmc_data::
+        RateLimit<RateLimitIface>(ctx, SyncBMCData::instance_path),
+    _manager(manager)
+{
+    bandwidth_limit_ = bandwidthLimit;
+    file_rate_limit_ = fileRateLimit;
+    burst_ = static_cast<std::uint64_t>(burst.count());
+    emit_added();
+}
+
+bool RateLimitIface::set_property([[maybe_unused]] bandwidth_limit_t type,
+                                  std::uint64_t bandwidthLimit)
+{
+    if (bandwidth_limit_ == bandwidthLimit)
+    {
+        return false;
+    }
+    validateRateLimit(bandwidthLimit, file_rate_limit_, burst_);
+    bandwidth_limit_ = bandwidthLimit;
+    applyRateLimit();
+    return true;
+}
+
+bool RateLimitIface::set_property([[maybe_unused]] file_rate_limit_t type,
+                                  std::uint64_t fileRateLimit)
+{
+    if (file_rate_limit_ == fileRateLimit)
+    {
+        return false;
+    }
+    validateRateLimit(bandwidth_limit_, fileRateLimit, burst_);
+    file_rate_limit_ = fileRateLimit;
+    applyRateLimit();
+    return true;
+}
+
+bool RateLimitIface::set_property([[maybe_unused]] burst_t type,
+                                  std::uint64_t burst)
+{
+    if (burst_ == burst)
+    {
+        return false;
+    }
+    validateRateLimit(bandwidth_limit_, file_rate_limit_, burst);
+    burst_ = burst;
+    applyRateLimit();
+    return true;
+}
+
+void RateLimitIface::validateRateLimit(std::uint64_t bandwidthLimit,
+                                       std::uint64_t fileRateLimit,
+                                       std::uint64_t burst)
+{
+    if (burst == 0)
+    {
+        lg2::error("The burst of the sync rate limit must not be zero");
+        throw sdbusplus::xyz::openbmc_project::Common::Error::
+            InvalidArgument();
+    }
+
+    auto byteRate = TokenBucket::checkedMul(bandwidthLimit, 1024);
+    if (!byteRate.has_value() ||
+        !TokenBucket::checkedMul(*byteRate, burst).has_value() ||
+        !TokenBucket::checkedMul(fileRateLimit, burst).has_value())
+    {
+        lg2::error("The sync rate limit of {BANDWIDTH_LIMIT} KiB/s and "
+                   "{FILE_RATE_LIMIT} files/s with the burst of {BURST_SEC} "
+                   "sec overflows",
+                   "BANDWIDTH_LIMIT", bandwidthLimit, "FILE_RATE_LIMIT",
+                   fileRateLimit, "BURST_SEC", burst);
+        throw sdbusplus::xyz::openbmc_project::Common::Error::
+            InvalidArgument();
+    }
+}
+
+void RateLimitIface::applyRateLimit()
+{
+    _manager.setSyncRateLimit(bandwidth_limit_, file_rate_limit_,
+                              std::chrono::seconds(burst_));
+}
+
+StatisticsIface::StatisticsIface(sdbusplus::async::context& ctx) :
+    sdbusplus::aserver::xyz::openbmc_project::control::sync_bmc_data::
+        Statistics<StatisticsIface>(ctx, SyncBMCData::instance_path)
+{
+    emit_added();
+}
+
 } // namespace data_sync::dbus_ifaces
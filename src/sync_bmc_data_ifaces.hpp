@@ -6,8 +6,15 @@
 
 #include <sdbusplus/async.hpp>
 #include <sdbusplus/message.hpp>
+#include <xyz/openbmc_project/Control/SyncBMCData/FullSync/aserver.hpp>
+#include <xyz/openbmc_project/Control/SyncBMCData/RateLimit/aserver.hpp>
+#include <xyz/openbmc_project/Control/SyncBMCData/Statistics/aserver.hpp>
 #include <xyz/openbmc_project/Control/SyncBMCData/aserver.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <string>
+
 namespace data_sync
 {
 class Manager;
@@ -63,5 +70,177 @@ class SyncBMCDataIface :
      */
     sdbusplus::async::context& _ctx;
 };
+
+/**
+ * @class FullSyncIface
+ *
+ * @brief FullSyncIface class implements the dbus server functionality to
+ *        control the full sync and to provide its progress, it is hosted on
+ *        the object of the SyncBMCData interface.
+ */
+class FullSyncIface :
+    public sdbusplus::aserver::xyz::openbmc_project::control::sync_bmc_data::
+        FullSync<FullSyncIface>
+{
+  public:
+    FullSyncIface(const FullSyncIface&) = delete;
+    FullSyncIface& operator=(const FullSyncIface&) = delete;
+    FullSyncIface(FullSyncIface&&) = delete;
+    FullSyncIface& operator=(FullSyncIface&&) = delete;
+    virtual ~FullSyncIface() = default;
+
+    /**
+     * @brief Constructor for FullSyncIface.
+     *
+     * @param[in] ctx Reference to the async D-Bus context.
+     * @param[in] manager Reference of the manager.
+     */
+    FullSyncIface(sdbusplus::async::context& ctx, data_sync::Manager& manager);
+
+    /**
+     * @brief Handles the Cancel method call for the FullSync interface.
+     *
+     * @param[in] type Method type identifier.
+     */
+    sdbusplus::async::task<> method_call(cancel_t type);
+
+    /**
+     * @brief Handles the StartScoped method call for the FullSync interface.
+     *
+     * @param[in] type Method type identifier.
+     * @param[in] pathPrefix The path prefix to sync, empty if not scoped by
+     *                       the path.
+     * @param[in] configFile The configuration file to sync, empty if not
+     *                       scoped by the file.
+     */
+    sdbusplus::async::task<> method_call(start_scoped_t type,
+                                         std::string pathPrefix,
+                                         std::string configFile);
+
+  private:
+    /**
+     * @brief Reference to the Manager object.
+     */
+    Manager& _manager;
+
+    /**
+     * @brief The async context object used to perform operations
+     *        asynchronously as required.
+     */
+    sdbusplus::async::context& _ctx;
+};
+/**
+ * @class RateLimitIface
+ *
+ * @brief RateLimitIface class implements the dbus server functionality to
+ *        adjust the global rate limit of the sync traffic, it is hosted on
+ *        the object of the SyncBMCData interface.
+ */
+class RateLimitIface :
+    public sdbusplus::aserver::xyz::openbmc_project::control::sync_bmc_data::
+        RateLimit<RateLimitIface>
+{
+  public:
+    RateLimitIface(const RateLimitIface&) = delete;
+    RateLimitIface& operator=(const RateLimitIface&) = delete;
+    RateLimitIface(RateLimitIface&&) = delete;
+    RateLimitIface& operator=(RateLimitIface&&) = delete;
+    virtual ~RateLimitIface() = default;
+
+    /**
+     * @brief Constructor for RateLimitIface.
+     *
+     * @param[in] ctx Reference to the async D-Bus context.
+     * @param[in] manager Reference of the manager.
+     * @param[in] bandwidthLimit The initial bandwidth limit in KiB per
+     *                           second.
+     * @param[in] fileRateLimit The initial limit of the files per second.
+     * @param[in] burst The initial burst of the limits.
+     */
+    RateLimitIface(sdbusplus::async::context& ctx, data_sync::Manager& manager,
+                   std::uint64_t bandwidthLimit, std::uint64_t fileRateLimit,
+                   std::chrono::seconds burst);
+
+    /**
+     * @brief Handles the write of the BandwidthLimit property.
+     *
+     * @param[in] type Property type identifier.
+     * @param[in] bandwidthLimit The bandwidth limit in KiB per second.
+     *
+     * @return True if the property is changed; otherwise False.
+     */
+    bool set_property(bandwidth_limit_t type, std::uint64_t bandwidthLimit);
+
+    /**
+     * @brief Handles the write of the FileRateLimit property.
+     *
+     * @param[in] type Property type identifier.
+     * @param[in] fileRateLimit The limit of the files per second.
+     *
+     * @return True if the property is changed; otherwise False.
+     */
+    bool set_property(file_rate_limit_t type, std::uint64_t fileRateLimit);
+
+    /**
+     * @brief Handles the write of the Burst property.
+     *
+     * @param[in] type Property type identifier.
+     * @param[in] burst The burst in seconds worth of the limits.
+     *
+     * @return True if the property is changed; otherwise False.
+     */
+    bool set_property(burst_t type, std::uint64_t burst);
+
+  private:
+    /**
+     * @brief Check the rate limit to write, the burst must not be zero and
+     *        the limits over the burst must not overflow.
+     *
+     * @param[in] bandwidthLimit The bandwidth limit in KiB per second.
+     * @param[in] fileRateLimit The limit of the files per second.
+     * @param[in] burst The burst in seconds worth of the limits.
+     *
+     * @throw InvalidArgument if the rate limit is not valid.
+     */
+    static void validateRateLimit(std::uint64_t bandwidthLimit,
+                                  std::uint64_t fileRateLimit,
+                                  std::uint64_t burst);
+
+    /**
+     * @brief Apply the written rate limit to the sync traffic.
+     */
+    void applyRateLimit();
+
+    /**
+     * @brief Reference to the Manager object.
+     */
+    Manager& _manager;
+};
+
+/**
+ * @class StatisticsIface
+ *
+ * @brief StatisticsIface class implements the dbus server functionality to
+ *        provide the statistics of the data sync, it is hosted on the object
+ *        of the SyncBMCData interface.
+ */
+class StatisticsIface :
+    public sdbusplus::aserver::xyz::openbmc_project::control::sync_bmc_data::
+        Statistics<StatisticsIface>
+{
+  public:
+    StatisticsIface(const StatisticsIface&) = delete;
+    StatisticsIface& operator=(const StatisticsIface&) = delete;
+    StatisticsIface(StatisticsIface&&) = delete;
+    StatisticsIface& operator=(StatisticsIface&&) = delete;
+    virtual ~StatisticsIface() = default;
+
+    /**
+     * @brief Constructor for StatisticsIface.
+     *
+     * @param[in] ctx Reference to the async D-Bus context.
+     */
+    explicit StatisticsIface(sdbusplus::async::context& ctx);
+};
 } // namespace dbus_ifaces
 } // namespace data_sync
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_plan.hpp"
+
+#include <algorithm>
+
+namespace data_sync
+{
+
+SyncPlan::SyncPlan(const config::ConfigStore& configStore,
+                   ext_data::BMCRole bmcRole) : _bmcRole(bmcRole)
+{
+    using enum config::SyncDirection;
+
+    for (auto syncType : {config::SyncType::Immediate, config::SyncType::Periodic})
+    {
+        auto& cfgs = _cfgsBySyncType[static_cast<std::size_t>(syncType)];
+        for (auto syncDirection : {Active2Passive, Passive2Active, Bidirectional})
+        {
+            if (isEligible(syncDirection, bmcRole))
+            {
+                const auto& modeCfgs = configStore.findBySyncMode(
+                    syncType, syncDirection);
+                cfgs.insert(cfgs.end(), modeCfgs.begin(), modeCfgs.end());
+            }
+        }
+
+        // Keep the configured order across the sync directions.
+        std::ranges::sort(cfgs);
+    }
+}
+
+} // namespace data_sync
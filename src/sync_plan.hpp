@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "config_store.hpp"
+#include "external_data_ifaces.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace data_sync
+{
+
+/**
+ * @class SyncPlan
+ *
+ * @brief The class holds the data sync configurations which are eligible to
+ *        sync in a BMC role, grouped by the sync type.
+ *
+ *        The plan is computed once from the sync mode index of the config
+ *        store so that the full sync and the sync events iterate the
+ *        prebuilt lists instead of checking each configuration.
+ *
+ * @note The plan refers to the configurations by their index in the store,
+ *       hence it must be rebuilt once the store is changed.
+ */
+class SyncPlan
+{
+  public:
+    /**
+     * @brief The constructor plans the configurations for the given role.
+     *
+     * @param[in] configStore - The data sync configurations
+     * @param[in] bmcRole - The BMC role
+     */
+    SyncPlan(const config::ConfigStore& configStore, ext_data::BMCRole bmcRole);
+
+    /**
+     * @brief Check whether the data of the given sync direction is synced
+     *        in the given role.
+     *
+     * @param[in] syncDirection - The sync direction
+     * @param[in] bmcRole - The BMC role
+     *
+     * @return True if synced; otherwise False.
+     */
+    static constexpr bool isEligible(config::SyncDirection syncDirection,
+                                     ext_data::BMCRole bmcRole)
+    {
+        using enum config::SyncDirection;
+        using enum ext_data::BMCRole;
+
+        return (syncDirection == Bidirectional) ||
+               ((syncDirection == Active2Passive) && (bmcRole == Active)) ||
+               ((syncDirection == Passive2Active) && (bmcRole == Passive));
+    }
+
+    /**
+     * @brief Get the BMC role of the plan.
+     */
+    ext_data::BMCRole bmcRole() const
+    {
+        return _bmcRole;
+    }
+
+    /**
+     * @brief Get the eligible configurations of the given sync type.
+     *
+     * @param[in] syncType - The sync type
+     *
+     * @return The indices of the configurations in the store.
+     */
+    const std::vector<std::uint32_t>& cfgs(config::SyncType syncType) const
+    {
+        return _cfgsBySyncType[static_cast<std::size_t>(syncType)];
+    }
+
+    /**
+     * @brief Get the number of the eligible configurations.
+     */
+    std::size_t size() const
+    {
+        return _cfgsBySyncType[0].size() + _cfgsBySyncType[1].size();
+    }
+
+  private:
+    /**
+     * @brief The BMC role of the plan.
+     */
+    ext_data::BMCRole _bmcRole;
+
+    /**
+     * @brief The indices of the eligible configurations of each sync type.
+     */
+    std::array<std::vector<std::uint32_t>, 2> _cfgsBySyncType;
+};
+
+} // namespace data_sync
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_scheduler.hpp"
+
+namespace data_sync
+{
+
+void SyncScheduler::submit(const config::DataSyncConfig& dataSyncCfg,
+                           Clock::time_point deadline)
+{
+    auto [pendingJob, added] = _pendingJobs.try_emplace(
+        dataSyncCfg._path, Job{dataSyncCfg, deadline});
+    if (added)
+    {
+        _deadlines.emplace(deadline, dataSyncCfg._path);
+        return;
+    }
+
+    // The pending sync covers the latest configuration and the earliest
+    // deadline.
+    pendingJob->second._dataSyncCfg = dataSyncCfg;
+    if (deadline < pendingJob->second._deadline)
+    {
+        _deadlines.erase({pendingJob->second._deadline, dataSyncCfg._path});
+        _deadlines.emplace(deadline, dataSyncCfg._path);
+        pendingJob->second._deadline = deadline;
+    }
+}
+
+std::optional<SyncScheduler::Job> SyncScheduler::start()
+{
+    if (_runningCount >= _maxRunning || _deadlines.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto earliest = _deadlines.extract(_deadlines.begin());
+    auto pendingJob = _pendingJobs.extract(earliest.value().second);
+    ++_runningCount;
+    return std::move(pendingJob.mapped());
+}
+
+bool SyncScheduler::finish(const Job& job, Clock::time_point now)
+{
+    --_runningCount;
+    if (now <= job._deadline)
+    {
+        return false;
+    }
+
+    ++_deadlineMisses[job._dataSyncCfg._path];
+    return true;
+}
+
+std::size_t SyncScheduler::deadlineMisses(std::string_view path) const
+{
+    auto deadlineMiss = _deadlineMisses.find(path);
+    return deadlineMiss != _deadlineMisses.end() ? deadlineMiss->second : 0;
+}
+
+} // namespace data_sync
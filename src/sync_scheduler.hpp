@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_sync_config.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace data_sync
+{
+
+/**
+ * @class SyncScheduler
+ *
+ * @brief The class schedules the pending syncs of the configured data in the
+ *        order of their deadlines (earliest deadline first), so that the
+ *        urgent sync goes ahead of the queued bulk or periodic syncs once
+ *        the concurrent syncs are bounded.
+ *
+ *        - A sync which is submitted again while it is pending is coalesced
+ *          into the pending one with the earliest of the deadlines.
+ *        - A sync which is submitted while it is running is pending again
+ *          to sync the changes made meanwhile.
+ *        - A sync which finishes after its deadline is counted as
+ *          a deadline miss of its path.
+ */
+class SyncScheduler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The structure contains a sync to run.
+     */
+    struct Job
+    {
+        /**
+         * @brief The data sync configuration to sync.
+         */
+        config::DataSyncConfig _dataSyncCfg;
+
+        /**
+         * @brief The time by which the sync should be finished.
+         */
+        Clock::time_point _deadline;
+    };
+
+    /**
+     * @brief The constructor of the scheduler.
+     *
+     * @param[in] maxRunning - The maximum number of the concurrent syncs
+     */
+    explicit SyncScheduler(std::size_t maxRunning) : _maxRunning(maxRunning)
+    {}
+
+    /**
+     * @brief Submit the sync of the given data.
+     *
+     * @param[in] dataSyncCfg - The data sync configuration to sync
+     * @param[in] deadline - The time by which the sync should be finished
+     */
+    void submit(const config::DataSyncConfig& dataSyncCfg,
+                Clock::time_point deadline);
+
+    /**
+     * @brief Start the pending sync of the earliest deadline if the number
+     *        of the running syncs is under the limit.
+     *
+     * @return The sync to run, nullopt if none can be started.
+     */
+    std::optional<Job> start();
+
+    /**
+     * @brief Finish the given running sync.
+     *
+     * @param[in] job - The finished sync
+     * @param[in] now - The current time
+     *
+     * @return True if the sync missed its deadline; otherwise False.
+     */
+    bool finish(const Job& job, Clock::time_point now);
+
+    /**
+     * @brief Get the number of the pending syncs.
+     */
+    std::size_t pendingCount() const
+    {
+        return _pendingJobs.size();
+    }
+
+    /**
+     * @brief Get the number of the running syncs.
+     */
+    std::size_t runningCount() const
+    {
+        return _runningCount;
+    }
+
+    /**
+     * @brief Get the number of the deadline misses of the given path.
+     *
+     * @param[in] path - The configured path
+     *
+     * @return The number of the deadline misses
+     */
+    std::size_t deadlineMisses(std::string_view path) const;
+
+  private:
+    /**
+     * @brief The maximum number of the concurrent syncs.
+     */
+    std::size_t _maxRunning;
+
+    /**
+     * @brief The number of the running syncs.
+     */
+    std::size_t _runningCount{0};
+
+    /**
+     * @brief The pending syncs by the configured path.
+     */
+    std::map<std::string, Job, std::less<>> _pendingJobs;
+
+    /**
+     * @brief The pending syncs in the order of their deadlines.
+     */
+    std::set<std::pair<Clock::time_point, std::string>> _deadlines;
+
+    /**
+     * @brief The number of the deadline misses by the configured path.
+     */
+    std::map<std::string, std::size_t, std::less<>> _deadlineMisses;
+};
+
+} // namespace data_sync
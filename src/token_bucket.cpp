@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "token_bucket.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace data_sync
+{
+
+TokenBucket::TokenBucket(std::uint64_t rate, std::uint64_t burst,
+                         Clock::time_point now) :
+    _rate(rate), _burst(burst), _tokens(static_cast<double>(burst)),
+    _refillTime(now)
+{}
+
+void TokenBucket::configure(std::uint64_t rate, std::uint64_t burst,
+                            Clock::time_point now)
+{
+    // The bucket which was not limited starts full.
+    refill(now);
+    _tokens = _rate == 0 ? static_cast<double>(burst)
+                         : std::min(_tokens, static_cast<double>(burst));
+    _rate = rate;
+    _burst = burst;
+}
+
+std::optional<std::uint64_t> TokenBucket::checkedMul(std::uint64_t lhs,
+                                                     std::uint64_t rhs)
+{
+    if (rhs != 0 && lhs > std::numeric_limits<std::uint64_t>::max() / rhs)
+    {
+        return std::nullopt;
+    }
+    return lhs * rhs;
+}
+
+void TokenBucket::consume(std::uint64_t tokens, Clock::time_point now)
+{
+    if (_rate == 0)
+    {
+        return;
+    }
+    refill(now);
+    _tokens -= static_cast<double>(tokens);
+}
+
+TokenBucket::Clock::duration TokenBucket::delay(Clock::time_point now)
+{
+    if (_rate == 0)
+    {
+        return Clock::duration::zero();
+    }
+    refill(now);
+    if (_tokens >= 0)
+    {
+        return Clock::duration::zero();
+    }
+    return std::chrono::ceil<Clock::duration>(
+        std::chrono::duration<double>(-_tokens / static_cast<double>(_rate)));
+}
+
+void TokenBucket::refill(Clock::time_point now)
+{
+    if (now > _refillTime)
+    {
+        auto elapsed = std::chrono::duration<double>(now - _refillTime);
+        _tokens = std::min(_tokens + (elapsed.count() *
+                                      static_cast<double>(_rate)),
+                           static_cast<double>(_burst));
+    }
+    _refillTime = std::max(_refillTime, now);
+}
+
+} // namespace data_sync
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace data_sync
+{
+
+/**
+ * @class TokenBucket
+ *
+ * @brief The class limits the rate of the sync traffic by a token bucket.
+ *
+ *        - The tokens are refilled at the rate up to the burst, so that the
+ *          traffic after an idle period is allowed at once.
+ *        - The amount of a transfer is known only once it is finished,
+ *          hence the transfer consumes the tokens afterwards and may leave
+ *          the bucket in debt, which delays the next transfers until it is
+ *          paid off.
+ *        - The rate of zero disables the limit.
+ */
+class TokenBucket
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The constructor of the bucket.
+     *
+     * @param[in] rate - The tokens refilled per second, zero for no limit
+     * @param[in] burst - The maximum tokens to accumulate
+     * @param[in] now - The current time
+     */
+    TokenBucket(std::uint64_t rate, std::uint64_t burst,
+                Clock::time_point now);
+
+    /**
+     * @brief Adjust the rate and the burst of the bucket, the debt is kept
+     *        if it was limited.
+     *
+     * @param[in] rate - The tokens refilled per second, zero for no limit
+     * @param[in] burst - The maximum tokens to accumulate
+     * @param[in] now - The current time
+     */
+    void configure(std::uint64_t rate, std::uint64_t burst,
+                   Clock::time_point now);
+
+    /**
+     * @brief Consume the given tokens.
+     *
+     * @param[in] tokens - The tokens to consume
+     * @param[in] now - The current time
+     */
+    void consume(std::uint64_t tokens, Clock::time_point now);
+
+    /**
+     * @brief Get the time to wait until the debt of the bucket is paid off.
+     *
+     * @param[in] now - The current time
+     *
+     * @return The time to wait, zero if a transfer is allowed now.
+     */
+    Clock::duration delay(Clock::time_point now);
+
+    /**
+     * @brief Multiply the given amounts of the limits without the overflow.
+     *
+     * @param[in] lhs - The left operand
+     * @param[in] rhs - The right operand
+     *
+     * @return The product, std::nullopt if it overflows.
+     */
+    static std::optional<std::uint64_t> checkedMul(std::uint64_t lhs,
+                                                   std::uint64_t rhs);
+
+    /**
+     * @brief Get the tokens refilled per second, zero if not limited.
+     */
+    std::uint64_t rate() const
+    {
+        return _rate;
+    }
+
+    /**
+     * @brief Get the maximum tokens to accumulate.
+     */
+    std::uint64_t burst() const
+    {
+        return _burst;
+    }
+
+  private:
+    /**
+     * @brief Refill the tokens for the time elapsed since the last refill.
+     *
+     * @param[in] now - The current time
+     */
+    void refill(Clock::time_point now);
+
+    /**
+     * @brief The tokens refilled per second.
+     */
+    std::uint64_t _rate;
+
+    /**
+     * @brief The maximum tokens to accumulate.
+     */
+    std::uint64_t _burst;
+
+    /**
+     * @brief The available tokens, negative if in debt.
+     */
+    double _tokens;
+
+    /**
+     * @brief The time of the last refill.
+     */
+    Clock::time_point _refillTime;
+};
+
+} // namespace data_sync
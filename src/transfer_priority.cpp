@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "transfer_priority.hpp"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <charconv>
+#include <fstream>
+#include <system_error>
+
+namespace data_sync::transfer
+{
+
+namespace
+{
+
+/**
+ * @brief The ioprio_set(2) target of a process, the id 0 targets the
+ *        calling thread.
+ */
+constexpr int ioprioWhoProcess = 1;
+
+/**
+ * @brief The shift of the class in the ioprio_set(2) priority value.
+ */
+constexpr int ioprioClassShift = 13;
+
+/**
+ * @brief Write the given value into the given cgroup interface file.
+ *
+ * @param[in] file - The cgroup interface file
+ * @param[in] value - The value to write
+ *
+ * @return True if written; otherwise False.
+ */
+bool writeCgroupFile(const fs::path& file, const std::string& value)
+{
+    std::ofstream cgroupFile(file);
+    cgroupFile << value;
+    cgroupFile.flush();
+    if (!cgroupFile)
+    {
+        lg2::error("Failed to write [{VALUE}] into {FILE}", "VALUE", value,
+                   "FILE", file);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+std::optional<cpu_set_t> parseCpuList(std::string_view cpuList)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    auto parseCpu = [&cpuList](int& cpu) {
+        const auto* begin = cpuList.data();
+        auto [end, ec] = std::from_chars(begin, begin + cpuList.size(), cpu);
+        if (ec != std::errc{} || cpu < 0 || cpu >= CPU_SETSIZE)
+        {
+            return false;
+        }
+        cpuList.remove_prefix(static_cast<std::size_t>(end - begin));
+        return true;
+    };
+
+    while (!cpuList.empty())
+    {
+        int firstCpu = 0;
+        if (!parseCpu(firstCpu))
+        {
+            return std::nullopt;
+        }
+        int lastCpu = firstCpu;
+        if (cpuList.starts_with('-'))
+        {
+            cpuList.remove_prefix(1);
+            if (!parseCpu(lastCpu) || lastCpu < firstCpu)
+            {
+                return std::nullopt;
+            }
+        }
+        for (auto cpu = firstCpu; cpu <= lastCpu; ++cpu)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+
+        if (cpuList.starts_with(','))
+        {
+            cpuList.remove_prefix(1);
+            if (cpuList.empty())
+            {
+                return std::nullopt;
+            }
+        }
+        else if (!cpuList.empty())
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (CPU_COUNT(&cpuSet) == 0)
+    {
+        return std::nullopt;
+    }
+    return cpuSet;
+}
+
+std::optional<std::string> setupCgroup(const fs::path& cgroup,
+                                       std::uint32_t cpuWeight,
+                                       std::uint32_t ioWeight)
+{
+    std::error_code ec;
+    fs::create_directories(cgroup, ec);
+    if (ec)
+    {
+        lg2::error("Failed to create the cgroup of the transfers: {CGROUP}, "
+                   "error: {ERROR}",
+                   "CGROUP", cgroup, "ERROR", ec.message());
+        return std::nullopt;
+    }
+
+    // The weights are available only if the controllers are enabled by the
+    // parent, the transfers are still moved into the cgroup otherwise.
+    writeCgroupFile(cgroup / "cpu.weight", std::to_string(cpuWeight));
+    writeCgroupFile(cgroup / "io.weight",
+                    "default " + std::to_string(ioWeight));
+
+    return (cgroup / "cgroup.procs").string();
+}
+
+void applyPriority(const Priority& priority, int cgroupProcsFd) noexcept
+{
+    if (cgroupProcsFd >= 0)
+    {
+        // Writing 0 moves the calling process into the cgroup.
+        [[maybe_unused]] auto written = write(cgroupProcsFd, "0", 1);
+    }
+    applyThreadPriority(priority);
+}
+
+void applyThreadPriority(const Priority& priority) noexcept
+{
+    if (priority._nice.has_value())
+    {
+        setpriority(PRIO_PROCESS, 0, *priority._nice);
+    }
+
+    if (priority._ioClass != IOClass::None)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        syscall(SYS_ioprio_set, ioprioWhoProcess, 0,
+                (static_cast<int>(priority._ioClass) << ioprioClassShift) |
+                    priority._ioLevel);
+    }
+
+    if (priority._cpuAffinity.has_value())
+    {
+        sched_setaffinity(0, sizeof(cpu_set_t), &*priority._cpuAffinity);
+    }
+}
+
+} // namespace data_sync::transfer
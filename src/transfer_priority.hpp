@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <sched.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace data_sync::transfer
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The I/O scheduling classes of the ioprio_set(2).
+ */
+enum class IOClass : std::uint8_t
+{
+    None = 0,
+    Realtime = 1,
+    BestEffort = 2,
+    Idle = 3
+};
+
+/**
+ * @brief The structure contains the scheduling priority of the spawned
+ *        transfer process, the unset members are inherited from the daemon.
+ */
+struct Priority
+{
+    /**
+     * @brief The nice value.
+     */
+    std::optional<int> _nice;
+
+    /**
+     * @brief The I/O scheduling class.
+     */
+    IOClass _ioClass{IOClass::None};
+
+    /**
+     * @brief The I/O priority level within the class, 0 (highest) to 7.
+     */
+    int _ioLevel{0};
+
+    /**
+     * @brief The CPUs which the transfer is allowed to run on.
+     */
+    std::optional<cpu_set_t> _cpuAffinity;
+
+    /**
+     * @brief The cgroup.procs file of the cgroup to move the transfer into.
+     */
+    std::optional<std::string> _cgroupProcs;
+};
+
+/**
+ * @brief Parse the given list of the CPUs, e.g. "0-1,3".
+ *
+ * @param[in] cpuList - The list of the CPU numbers and ranges
+ *
+ * @return The CPU set, nullopt if the list is empty or invalid.
+ */
+std::optional<cpu_set_t> parseCpuList(std::string_view cpuList);
+
+/**
+ * @brief Create the cgroup of the transfers with the given weights.
+ *
+ * @param[in] cgroup - The path of the cgroup in the cgroup v2 hierarchy
+ * @param[in] cpuWeight - The cpu.weight of the cgroup, 1 to 10000
+ * @param[in] ioWeight - The io.weight of the cgroup, 1 to 10000
+ *
+ * @return The cgroup.procs file of the cgroup, nullopt if failed.
+ */
+std::optional<std::string> setupCgroup(const fs::path& cgroup,
+                                       std::uint32_t cpuWeight,
+                                       std::uint32_t ioWeight);
+
+/**
+ * @brief Apply the given priority to the calling process.
+ *
+ * @param[in] priority - The priority to apply
+ * @param[in] cgroupProcsFd - The cgroup.procs file of the priority opened
+ *                            by the caller, negative to not move the
+ *                            process into the cgroup
+ *
+ * @note It is called in the forked transfer process of the multithreaded
+ *       daemon before the exec, hence it makes only the raw system calls
+ *       on the state prepared before the fork, and ignores the failures to
+ *       not fail the transfer.
+ */
+void applyPriority(const Priority& priority, int cgroupProcsFd) noexcept;
+
+/**
+ * @brief Apply the given priority to the calling thread, except the cgroup
+ *        which applies to the whole process.
+ *
+ * @param[in] priority - The priority to apply
+ *
+ * @note The nice value, the I/O priority and the CPU affinity are of the
+ *       thread on Linux.
+ */
+void applyThreadPriority(const Priority& priority) noexcept;
+
+} // namespace data_sync::transfer
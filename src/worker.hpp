@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "fd.hpp"
+
+#include <sys/eventfd.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace data_sync
+{
+
+/**
+ * @brief Run the given blocking job, like walking or hashing the data, on
+ *        a worker thread without blocking the event loop.
+ *
+ * @param[in] ctx - The async context
+ * @param[in] job - The job to run, it must not use the state which is
+ *                  changed by the event loop meanwhile
+ *
+ * @return The result of the job.
+ *
+ * @note The job is run in place if the worker is not notifiable.
+ */
+template <typename Job>
+    requires(!std::is_void_v<std::invoke_result_t<Job&>>)
+sdbusplus::async::task<std::invoke_result_t<Job&>>
+    // NOLINTNEXTLINE
+    runInWorker(sdbusplus::async::context& ctx, Job job)
+{
+    FD doneEventFd{eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)};
+    if (doneEventFd() < 0)
+    {
+        co_return job();
+    }
+    sdbusplus::async::fdio fdioInstance{ctx, doneEventFd()};
+
+    std::optional<std::invoke_result_t<Job&>> result;
+    std::atomic<bool> done{false};
+
+    // The worker is declared last to join it before destroying the state it
+    // uses, also if the context is stopped while waiting.
+    std::jthread worker{[&job, &result, &done, &doneEventFd]() {
+        result.emplace(job());
+        done = true;
+        eventfd_write(doneEventFd(), 1);
+    }};
+
+    while (!done)
+    {
+        // NOLINTNEXTLINE
+        co_await fdioInstance.next();
+    }
+    worker.join();
+    co_return std::move(*result);
+}
+
+} // namespace data_sync
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "builtin_config.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::config::BuiltinConfig;
+using data_sync::config::Compression;
+using data_sync::config::DataSyncConfig;
+using data_sync::config::SyncDirection;
+using data_sync::config::SyncType;
+using data_sync::config::toDataSyncConfig;
+using namespace std::literals;
+
+namespace
+{
+
+constexpr std::array<std::string_view, 1> excludeFileList{
+    "/directory/path/to/sync/file1"sv};
+
+constexpr std::array<BuiltinConfig, 2> builtinCfgs{
+    {{._path = "/directory/path/to/sync/"sv,
+      ._syncDirection = SyncDirection::Bidirectional,
+      ._syncType = SyncType::Periodic,
+      ._destPath = "/directory/path/to/dest/"sv,
+      ._periodicityInSec = std::chrono::seconds(60),
+      ._retryAttempts = 2,
+      ._retryIntervalInSec = std::chrono::seconds(10),
+      ._excludeFileList = excludeFileList,
+      ._includeFileList = {},
+      ._tier = data_sync::config::criticalTier,
+      ._maxSyncLatency = std::nullopt,
+      ._bandwidthLimit = std::nullopt,
+      ._compression = Compression::Auto},
+     {._path = "/file/path/to/sync"sv,
+      ._syncDirection = SyncDirection::Active2Passive,
+      ._syncType = SyncType::Immediate,
+      ._destPath = ""sv,
+      ._periodicityInSec = std::nullopt,
+      ._retryAttempts = std::nullopt,
+      ._retryIntervalInSec = std::chrono::seconds(0),
+      ._excludeFileList = {},
+      ._includeFileList = {},
+      ._tier = data_sync::config::criticalTier,
+      ._maxSyncLatency = std::nullopt,
+      ._bandwidthLimit = std::nullopt,
+      ._compression = Compression::Auto}}};
+
+} // namespace
+
+/*
+ * Test the builtin configuration is the same as the one parsed from JSON.
+ */
+TEST(BuiltinConfigTest, TestBuiltinConfigMatchesJSON)
+{
+    nlohmann::json dirCfg = {
+        {"Path", "/directory/path/to/sync/"},
+        {"Description", "Builtin config test"},
+        {"SyncDirection", "Bidirectional"},
+        {"SyncType", "Periodic"},
+        {"Periodicity", "PT1M"},
+        {"DestinationPath", "/directory/path/to/dest/"},
+        {"ExcludeFilesList", {"/directory/path/to/sync/file1"}},
+        {"RetryAttempts", 2},
+        {"RetryInterval", "PT10S"}};
+
+    nlohmann::json fileCfg = {{"Path", "/file/path/to/sync"},
+                              {"Description", "Builtin config test"},
+                              {"SyncDirection", "Active2Passive"},
+                              {"SyncType", "Immediate"}};
+
+    EXPECT_EQ(toDataSyncConfig(builtinCfgs[0]), DataSyncConfig(dirCfg));
+    EXPECT_EQ(toDataSyncConfig(builtinCfgs[1]), DataSyncConfig(fileCfg));
+}
+
+/*
+ * Test the optional fields of the builtin configuration are the same as the
+ * ones parsed from JSON.
+ */
+TEST(BuiltinConfigTest, TestBuiltinConfigFieldsMatchJSON)
+{
+    struct FieldCase
+    {
+        // The field in the JSON configuration.
+        std::string _key;
+        nlohmann::json _value;
+
+        // Set the same field of the builtin configuration.
+        std::function<void(BuiltinConfig&)> _setField;
+    };
+
+    const std::vector<FieldCase> fieldCases{
+        {"Tier", 2, [](auto& cfg) { cfg._tier = 2; }},
+        {"MaxSyncLatency", "PT0.5S",
+         [](auto& cfg) { cfg._maxSyncLatency = 500ms; }},
+        {"BandwidthLimit", 512, [](auto& cfg) { cfg._bandwidthLimit = 512; }},
+        {"Compression", "Strong",
+         [](auto& cfg) { cfg._compression = Compression::Strong; }},
+    };
+
+    nlohmann::json fileCfg = {{"Path", "/file/path/to/sync"},
+                              {"Description", "Builtin config test"},
+                              {"SyncDirection", "Active2Passive"},
+                              {"SyncType", "Immediate"}};
+
+    for (const auto& fieldCase : fieldCases)
+    {
+        SCOPED_TRACE(fieldCase._key);
+
+        auto builtinCfg = builtinCfgs[1];
+        fieldCase._setField(builtinCfg);
+        auto fieldCfg = fileCfg;
+        fieldCfg[fieldCase._key] = fieldCase._value;
+
+        EXPECT_EQ(toDataSyncConfig(builtinCfg), DataSyncConfig(fieldCfg));
+    }
+}
+
+/*
+ * Test the runtime configuration overrides the builtin configuration of the
+ * same path.
+ */
+TEST(BuiltinConfigTest, TestRuntimeConfigOverridesBuiltin)
+{
+    nlohmann::json overrideCfg = {{"Path", "/directory/path/to/sync"},
+                                  {"Description", "Builtin config test"},
+                                  {"SyncDirection", "Active2Passive"},
+                                  {"SyncType", "Immediate"}};
+
+    nlohmann::json runtimeCfg = {{"Path", "/other/file/path/to/sync"},
+                                 {"Description", "Builtin config test"},
+                                 {"SyncDirection", "Active2Passive"},
+                                 {"SyncType", "Immediate"}};
+
+    std::vector<DataSyncConfig> dataSyncCfgs{DataSyncConfig(overrideCfg),
+                                             DataSyncConfig(runtimeCfg)};
+
+    data_sync::config::mergeBuiltinConfigs(builtinCfgs, dataSyncCfgs);
+
+    ASSERT_EQ(dataSyncCfgs.size(), 3U);
+    EXPECT_EQ(dataSyncCfgs[0], toDataSyncConfig(builtinCfgs[1]));
+    EXPECT_EQ(dataSyncCfgs[1], DataSyncConfig(overrideCfg));
+    EXPECT_EQ(dataSyncCfgs[2], DataSyncConfig(runtimeCfg));
+}
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "change_journal.hpp"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+
+using data_sync::ChangeJournal;
+using data_sync::ChangeLog;
+
+class ChangeJournalTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpDir[] = "/tmp/pdsJournalDirXXXXXX";
+        _tmpDir = mkdtemp(tmpDir);
+        _journalFile = _tmpDir / "persist" / "change.journal";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_tmpDir);
+    }
+
+    fs::path _tmpDir;
+    fs::path _journalFile;
+};
+
+/*
+ * Test the committed changes and confirmations are restored as is.
+ */
+TEST_F(ChangeJournalTest, CommitAndLoad)
+{
+    ChangeLog changeLog;
+    {
+        ChangeJournal changeJournal{_journalFile};
+        EXPECT_FALSE(changeJournal.load(changeLog));
+
+        for (const auto* path : {"/dir/file1", "/dir/file2", "/file3"})
+        {
+            changeJournal.logChange(path, changeLog.record(path));
+        }
+        changeLog.confirm("/dir/", 2);
+        changeJournal.logConfirm("/dir/", 2);
+        changeJournal.logFullSync(0x1234);
+        EXPECT_TRUE(changeJournal.hasPendingRecords());
+        ASSERT_TRUE(changeJournal.commit());
+        EXPECT_FALSE(changeJournal.hasPendingRecords());
+
+        // The records waiting for the group commit are committed on exit.
+        changeJournal.logChange("/dir/file1", changeLog.record("/dir/file1"));
+    }
+
+    ChangeLog restoredLog;
+    ChangeJournal changeJournal{_journalFile};
+    EXPECT_TRUE(changeJournal.load(restoredLog));
+    EXPECT_EQ(restoredLog.changes(), changeLog.changes());
+    EXPECT_EQ(restoredLog.highWaterMarks(), changeLog.highWaterMarks());
+    EXPECT_EQ(restoredLog.sequence(), changeLog.sequence());
+    EXPECT_EQ(changeJournal.fullSyncFingerprint(), 0x1234U);
+}
+
+/*
+ * Test the valid records before the torn tail are restored but the journal
+ * is not reported intact.
+ */
+TEST_F(ChangeJournalTest, TornTail)
+{
+    {
+        ChangeJournal changeJournal{_journalFile};
+        changeJournal.logChange("/file1", 1);
+        changeJournal.logChange("/file2", 2);
+        ASSERT_TRUE(changeJournal.commit());
+    }
+
+    // Drop the last byte of the hash of the last record.
+    fs::resize_file(_journalFile, fs::file_size(_journalFile) - 1);
+
+    ChangeLog changeLog;
+    ChangeJournal changeJournal{_journalFile};
+    EXPECT_FALSE(changeJournal.load(changeLog));
+    EXPECT_EQ(changeLog.pendingChanges("/"),
+              std::vector<std::string>{"/file1"});
+
+    // The corrupted record is not restored either.
+    {
+        std::fstream file(_journalFile,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-2, std::ios::end);
+        file.put('\xff');
+    }
+    ChangeLog corruptedLog;
+    ChangeJournal corruptedJournal{_journalFile};
+    EXPECT_FALSE(corruptedJournal.load(corruptedLog));
+    EXPECT_EQ(corruptedLog.size(), 1U);
+}
+
+/*
+ * Test the compacted journal restores the same change log.
+ */
+TEST_F(ChangeJournalTest, Compact)
+{
+    ChangeLog changeLog{2};
+    {
+        ChangeJournal changeJournal{_journalFile};
+        for (const auto* path : {"/file1", "/file2", "/file1"})
+        {
+            changeJournal.logChange(path, changeLog.record(path));
+        }
+        changeLog.confirm("/file2", changeLog.sequence());
+        changeJournal.logConfirm("/file2", changeLog.sequence());
+        changeJournal.logFullSync(0x5678);
+        ASSERT_TRUE(changeJournal.commit());
+
+        auto journalSize = fs::file_size(_journalFile);
+        ASSERT_TRUE(changeJournal.compact(changeLog));
+        EXPECT_LT(fs::file_size(_journalFile), journalSize);
+
+        // The overflow is journaled until the next compaction.
+        changeLog.record("/file3");
+        changeLog.record("/file4");
+        ASSERT_TRUE(changeLog.overflowed());
+        changeJournal.logOverflow();
+        ASSERT_TRUE(changeJournal.commit());
+    }
+
+    ChangeLog restoredLog{2};
+    ChangeJournal changeJournal{_journalFile};
+    EXPECT_TRUE(changeJournal.load(restoredLog));
+    EXPECT_EQ(restoredLog.pendingChanges("/file1"),
+              std::vector<std::string>{"/file1"});
+    EXPECT_EQ(restoredLog.highWaterMark("/file2"), 3U);
+    EXPECT_TRUE(restoredLog.overflowed());
+    EXPECT_EQ(changeJournal.fullSyncFingerprint(), 0x5678U);
+}
+
+/*
+ * Test the progress of the full sync is restored until it is completed.
+ */
+TEST_F(ChangeJournalTest, FullSyncCheckpoint)
+{
+    ChangeLog changeLog;
+    {
+        ChangeJournal changeJournal{_journalFile};
+        changeJournal.logFullSyncStart(0x1111);
+        changeJournal.logFullSyncPath("/file1", 0x2222);
+        ASSERT_TRUE(changeJournal.commit());
+    }
+
+    {
+        ChangeJournal changeJournal{_journalFile};
+        EXPECT_TRUE(changeJournal.load(changeLog));
+        const auto& checkpoint = changeJournal.fullSyncCheckpoint();
+        ASSERT_TRUE(checkpoint.has_value());
+        EXPECT_EQ(checkpoint->_cfgFingerprint, 0x1111U);
+        EXPECT_EQ(checkpoint->_syncedPaths.size(), 1U);
+        EXPECT_EQ(checkpoint->_syncedPaths.at("/file1"), 0x2222U);
+
+        // The checkpoint is kept by the compaction.
+        changeJournal.logFullSyncPath("/file2", 0x3333);
+        ASSERT_TRUE(changeJournal.compact(changeLog));
+    }
+
+    {
+        ChangeJournal changeJournal{_journalFile};
+        EXPECT_TRUE(changeJournal.load(changeLog));
+        ASSERT_TRUE(changeJournal.fullSyncCheckpoint().has_value());
+        EXPECT_EQ(changeJournal.fullSyncCheckpoint()->_syncedPaths.size(), 2U);
+
+        changeJournal.logFullSync(0x1111);
+        EXPECT_FALSE(changeJournal.fullSyncCheckpoint().has_value());
+        ASSERT_TRUE(changeJournal.commit());
+    }
+
+    ChangeJournal changeJournal{_journalFile};
+    EXPECT_TRUE(changeJournal.load(changeLog));
+    EXPECT_FALSE(changeJournal.fullSyncCheckpoint().has_value());
+    EXPECT_EQ(changeJournal.fullSyncFingerprint(), 0x1111U);
+}
+
+/*
+ * Test the fingerprints of the data are restored only if nothing is
+ * journaled after the shutdown.
+ */
+TEST_F(ChangeJournalTest, ShutdownFingerprints)
+{
+    ChangeLog changeLog;
+    {
+        ChangeJournal changeJournal{_journalFile};
+        EXPECT_FALSE(changeJournal.load(changeLog));
+        EXPECT_FALSE(changeJournal.shutdownFingerprints().has_value());
+        changeJournal.logShutdown({{"/dir/", 0x1111}, {"/file1", 0x2222}});
+    }
+
+    {
+        ChangeJournal changeJournal{_journalFile};
+        EXPECT_TRUE(changeJournal.load(changeLog));
+        const auto& shutdownFingerprints = changeJournal.shutdownFingerprints();
+        ASSERT_TRUE(shutdownFingerprints.has_value());
+        EXPECT_EQ(shutdownFingerprints->size(), 2U);
+        EXPECT_EQ(shutdownFingerprints->at("/dir/"), 0x1111U);
+        EXPECT_EQ(shutdownFingerprints->at("/file1"), 0x2222U);
+
+        // The daemon is not stopped gracefully after this change.
+        changeJournal.logChange("/file1", changeLog.record("/file1"));
+    }
+
+    {
+        ChangeJournal changeJournal{_journalFile};
+        EXPECT_TRUE(changeJournal.load(changeLog));
+        EXPECT_FALSE(changeJournal.shutdownFingerprints().has_value());
+
+        // The fingerprints are not kept by the compaction.
+        changeJournal.logShutdown({{"/file1", 0x3333}});
+        ASSERT_TRUE(changeJournal.compact(changeLog));
+    }
+
+    ChangeJournal changeJournal{_journalFile};
+    EXPECT_TRUE(changeJournal.load(changeLog));
+    EXPECT_FALSE(changeJournal.shutdownFingerprints().has_value());
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "change_log.hpp"
+
+#include <gtest/gtest.h>
+
+using data_sync::ChangeLog;
+
+/*
+ * Test the changes of a path are logged once with the latest sequence and
+ * dropped once the sync is confirmed.
+ */
+TEST(ChangeLogTest, RecordAndConfirm)
+{
+    ChangeLog changeLog;
+    EXPECT_TRUE(changeLog.needsSync("/dir/"));
+    EXPECT_FALSE(changeLog.highWaterMark("/dir/").has_value());
+
+    EXPECT_EQ(changeLog.record("/dir/file1"), 1U);
+    EXPECT_EQ(changeLog.record("/dir/file2"), 2U);
+    EXPECT_EQ(changeLog.record("/dir/file1"), 3U);
+    EXPECT_EQ(changeLog.size(), 2U);
+
+    changeLog.confirm("/dir/", 2);
+    EXPECT_EQ(changeLog.highWaterMark("/dir/"), 2U);
+    EXPECT_EQ(changeLog.pendingChanges("/dir/"),
+              std::vector<std::string>{"/dir/file1"});
+    EXPECT_TRUE(changeLog.needsSync("/dir/"));
+
+    changeLog.confirm("/dir/", changeLog.sequence());
+    EXPECT_EQ(changeLog.highWaterMark("/dir/"), 3U);
+    EXPECT_TRUE(changeLog.pendingChanges("/dir/").empty());
+    EXPECT_FALSE(changeLog.needsSync("/dir/"));
+    EXPECT_EQ(changeLog.size(), 0U);
+
+    // The high-water mark never moves back.
+    changeLog.confirm("/dir/", 1);
+    EXPECT_EQ(changeLog.highWaterMark("/dir/"), 3U);
+}
+
+/*
+ * Test the changes are looked up only under the configured path.
+ */
+TEST(ChangeLogTest, PendingChangesOfPath)
+{
+    ChangeLog changeLog;
+    changeLog.record("/dir/file");
+    changeLog.record("/dir/file1");
+    changeLog.record("/dir/sub/file");
+    changeLog.record("/dir2/file");
+
+    EXPECT_EQ(changeLog.pendingChanges("/dir/file"),
+              std::vector<std::string>{"/dir/file"});
+    EXPECT_EQ(changeLog.pendingChanges("/dir/sub"),
+              std::vector<std::string>{"/dir/sub/file"});
+    EXPECT_EQ(changeLog.pendingChanges("/dir/").size(), 3U);
+    EXPECT_EQ(changeLog.pendingChanges("/dir").size(), 3U);
+    EXPECT_EQ(changeLog.pendingChanges("/").size(), 4U);
+
+    changeLog.confirm("/dir", changeLog.sequence());
+    EXPECT_EQ(changeLog.pendingChanges("/").size(), 1U);
+    EXPECT_FALSE(changeLog.needsSync("/dir"));
+    EXPECT_TRUE(changeLog.needsSync("/dir2/"));
+}
+
+/*
+ * Test the changes under a changed directory are compacted into it.
+ */
+TEST(ChangeLogTest, CompactUnderDir)
+{
+    ChangeLog changeLog;
+    changeLog.record("/dir/sub/file1");
+    changeLog.record("/dir/file2");
+    changeLog.record("/other/file");
+
+    // The changed directory replaces the changes under it.
+    auto dirSequence = changeLog.record("/dir/");
+    EXPECT_EQ(changeLog.pendingChanges("/dir/"),
+              std::vector<std::string>{"/dir/"});
+    EXPECT_EQ(changeLog.size(), 2U);
+
+    // The change under the changed directory only bumps its sequence.
+    auto fileSequence = changeLog.record("/dir/sub/file3");
+    EXPECT_GT(fileSequence, dirSequence);
+    EXPECT_EQ(changeLog.size(), 2U);
+
+    changeLog.confirm("/dir/", dirSequence);
+    EXPECT_TRUE(changeLog.hasPendingChanges("/dir/"));
+    changeLog.confirm("/dir/", fileSequence);
+    EXPECT_FALSE(changeLog.hasPendingChanges("/dir/"));
+    EXPECT_TRUE(changeLog.hasPendingChanges("/other/file"));
+}
+
+/*
+ * Test the changes are not logged once the log is full until it is reset.
+ */
+TEST(ChangeLogTest, OverflowAndReset)
+{
+    ChangeLog changeLog{2};
+    changeLog.record("/file1");
+    changeLog.record("/file2");
+    changeLog.record("/file1");
+    EXPECT_FALSE(changeLog.overflowed());
+
+    changeLog.record("/file3");
+    EXPECT_TRUE(changeLog.overflowed());
+    EXPECT_EQ(changeLog.size(), 2U);
+    EXPECT_TRUE(changeLog.hasPendingChanges("/file3"));
+    EXPECT_TRUE(changeLog.needsSync("/file4"));
+
+    changeLog.reset();
+    EXPECT_FALSE(changeLog.overflowed());
+    EXPECT_EQ(changeLog.size(), 0U);
+    EXPECT_FALSE(changeLog.hasPendingChanges("/file3"));
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "chunk_index.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using data_sync::ChunkIndex;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+/**
+ * @brief Make the given size of the pseudo-random content.
+ */
+std::string makeContent(std::size_t size, std::uint32_t seed)
+{
+    std::mt19937 random(seed);
+    std::string content(size, '\0');
+    for (auto& byte : content)
+    {
+        byte = static_cast<char>(random());
+    }
+    return content;
+}
+
+} // namespace
+
+TEST(ChunkIndexTest, ChunkIsBoundedAndStable)
+{
+    auto content = makeContent(512 * 1024, 1);
+    auto digests = ChunkIndex::chunk(content);
+
+    // The chunks average to 8 KiB and are at most 64 KiB.
+    EXPECT_GE(digests.size(), 8U);
+    EXPECT_LE(digests.size(), 256U);
+    EXPECT_EQ(ChunkIndex::chunk(content), digests);
+
+    EXPECT_TRUE(ChunkIndex::chunk("").empty());
+    EXPECT_EQ(ChunkIndex::chunk("small").size(), 1U);
+}
+
+TEST(ChunkIndexTest, InsertionShiftsOnlyNearbyChunks)
+{
+    auto content = makeContent(512 * 1024, 2);
+    auto digests = ChunkIndex::chunk(content);
+
+    auto inserted = content;
+    inserted.insert(256 * 1024, "inserted");
+    auto insertedDigests = ChunkIndex::chunk(inserted);
+
+    std::size_t shared = 0;
+    for (auto digest : insertedDigests)
+    {
+        shared += std::ranges::count(digests, digest) != 0 ? 1 : 0;
+    }
+    EXPECT_GE(shared + 3, digests.size());
+}
+
+TEST(ChunkIndexTest, ChunkFile)
+{
+    auto path = fs::temp_directory_path() / "chunk_index_test.bin";
+    auto content = makeContent(64 * 1024, 3);
+    std::ofstream(path, std::ios::binary) << content;
+
+    EXPECT_EQ(ChunkIndex::chunkFile(path.string()), ChunkIndex::chunk(content));
+    fs::remove(path);
+
+    EXPECT_TRUE(ChunkIndex::chunkFile(path.string()).empty());
+}
+
+TEST(ChunkIndexTest, IndexedDigestsOfUnchangedFile)
+{
+    auto path = fs::temp_directory_path() / "chunk_index_stamp_test.bin";
+    std::ofstream(path, std::ios::binary) << makeContent(16 * 1024, 6);
+
+    auto stamp = ChunkIndex::stampFile(path.string());
+    ASSERT_TRUE(stamp.has_value());
+    EXPECT_EQ(stamp->_size, 16U * 1024);
+
+    ChunkIndex index;
+    auto digests = ChunkIndex::chunkFile(path.string());
+    index.add("/dest/file", digests, stamp);
+    EXPECT_EQ(index.indexedDigests("/dest/file", *stamp), digests);
+
+    // The changed source is chunked again.
+    std::ofstream(path, std::ios::binary | std::ios::app) << "appended";
+    auto changedStamp = ChunkIndex::stampFile(path.string());
+    ASSERT_TRUE(changedStamp.has_value());
+    EXPECT_EQ(index.indexedDigests("/dest/file", *changedStamp),
+              std::nullopt);
+
+    // The file indexed without the stamp is chunked again as well.
+    index.add("/dest/file", digests);
+    EXPECT_EQ(index.indexedDigests("/dest/file", *stamp), std::nullopt);
+
+    fs::remove(path);
+    EXPECT_EQ(ChunkIndex::stampFile(path.string()), std::nullopt);
+}
+
+TEST(ChunkIndexTest, FindBasisSharingMostChunks)
+{
+    auto content = makeContent(256 * 1024, 4);
+    auto other = makeContent(256 * 1024, 5);
+
+    ChunkIndex index;
+    index.add("/dest/other", ChunkIndex::chunk(other));
+    index.add("/dest/half",
+              ChunkIndex::chunk(content.substr(0, 128 * 1024) + other));
+    index.add("/dest/copy", ChunkIndex::chunk(content));
+
+    auto digests = ChunkIndex::chunk(content + "appended");
+    EXPECT_EQ(index.findBasis("/dest/new", digests), "/dest/copy");
+
+    const auto& stats = index.stats();
+    EXPECT_EQ(stats._lookupChunks, digests.size());
+    EXPECT_GE(stats._hitChunks + 1, digests.size());
+    EXPECT_EQ(stats._basisCount, 1U);
+
+    // The file is not the basis of itself.
+    index.remove("/dest/copy");
+    index.add("/dest/new", digests);
+    EXPECT_EQ(index.findBasis("/dest/new", digests), "/dest/half");
+
+    // The previous content is replaced once it is synced again.
+    index.add("/dest/half", ChunkIndex::chunk(other));
+    EXPECT_EQ(index.findBasis("/dest/new", digests), std::nullopt);
+    EXPECT_EQ(index.stats()._basisCount, 2U);
+}
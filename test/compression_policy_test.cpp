@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "compression_policy.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+using data_sync::CompressionPolicy;
+using namespace std::literals;
+
+namespace fs = std::filesystem;
+
+class CompressionPolicyTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        _testDir = fs::temp_directory_path() / "compression_policy_test";
+        fs::remove_all(_testDir);
+        fs::create_directories(_testDir);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_testDir);
+    }
+
+    std::string writeFile(const std::string& name, const std::string& content)
+    {
+        auto path = (_testDir / name).string();
+        std::ofstream(path, std::ios::binary) << content;
+        return path;
+    }
+
+    static data_sync::config::DataSyncConfig
+        makeConfig(const std::string& path)
+    {
+        return data_sync::config::DataSyncConfig(
+            {{"Path", path},
+             {"Description", "Compression policy test"},
+             {"SyncDirection", "Active2Passive"},
+             {"SyncType", "Immediate"}});
+    }
+
+    fs::path _testDir;
+};
+
+/*
+ * Test the small and the already compressed files are not compressed.
+ */
+TEST_F(CompressionPolicyTest, SkipCompressedFiles)
+{
+    CompressionPolicy policy;
+    std::string text(8192, 'a');
+
+    auto textFile = writeFile("data.json", text);
+    auto decision = policy.decide(makeConfig(textFile));
+    ASSERT_TRUE(decision._level.has_value());
+    EXPECT_TRUE(decision._skipCompressed);
+
+    EXPECT_FALSE(policy.decide(makeConfig(writeFile("small.json", "{}")))
+                     ._level.has_value());
+    EXPECT_FALSE(policy.decide(makeConfig(writeFile("image.xz", text)))
+                     ._level.has_value());
+    EXPECT_FALSE(
+        policy.decide(makeConfig(writeFile("image", "\x1f\x8b" + text)))
+            ._level.has_value());
+
+    // The directory is compressed except the compressed files inside it.
+    decision = policy.decide(makeConfig(_testDir.string()));
+    ASSERT_TRUE(decision._level.has_value());
+    auto args = CompressionPolicy::rsyncArgs(decision);
+    ASSERT_EQ(args.size(), 4U);
+    EXPECT_EQ(args[0], "--compress");
+    EXPECT_EQ(args[2], "--compress-choice=zlib");
+    EXPECT_TRUE(args[3].starts_with("--skip-compress="));
+}
+
+/*
+ * Test the configured compression overrides the decision.
+ */
+TEST_F(CompressionPolicyTest, ConfiguredCompression)
+{
+    CompressionPolicy policy;
+    auto dataSyncCfg =
+        makeConfig(writeFile("image.xz", std::string(8192, 'a')));
+
+    dataSyncCfg._compression = data_sync::config::Compression::Strong;
+    auto args = CompressionPolicy::rsyncArgs(policy.decide(dataSyncCfg));
+    EXPECT_EQ(args, (std::vector<std::string>{"--compress",
+                                              "--compress-level=9",
+                                              "--compress-choice=zlib"}));
+
+    dataSyncCfg._compression = data_sync::config::Compression::Fast;
+    args = CompressionPolicy::rsyncArgs(policy.decide(dataSyncCfg));
+    EXPECT_EQ(args, (std::vector<std::string>{"--compress",
+                                              "--compress-level=1",
+                                              "--compress-choice=zlib"}));
+
+    dataSyncCfg._path = _testDir.string();
+    dataSyncCfg._compression = data_sync::config::Compression::Off;
+    EXPECT_TRUE(CompressionPolicy::rsyncArgs(policy.decide(dataSyncCfg))
+                    .empty());
+}
+
+/*
+ * Test the data of the poor measured ratio is not compressed until it is
+ * measured again and the savings are reported.
+ */
+TEST_F(CompressionPolicyTest, MeasuredRatio)
+{
+    CompressionPolicy policy;
+    auto dataSyncCfg = makeConfig(_testDir.string());
+
+    ASSERT_TRUE(policy.decide(dataSyncCfg)._level.has_value());
+    policy.record(dataSyncCfg._path, true, 1000, 990, 20ms);
+    EXPECT_EQ(policy.stats()._bytesSaved, 10U);
+
+    for (int count = 1; count < 16; ++count)
+    {
+        EXPECT_FALSE(policy.decide(dataSyncCfg)._level.has_value());
+        policy.record(dataSyncCfg._path, false, 1000, 1000, 10ms);
+    }
+    EXPECT_TRUE(policy.decide(dataSyncCfg)._level.has_value());
+
+    const auto& stats = policy.stats();
+    EXPECT_EQ(stats._compressedCount, 1U);
+    EXPECT_EQ(stats._uncompressedCount, 15U);
+    EXPECT_EQ(stats._cpuTimeSaved, 150ms);
+
+    // The compressible data is compressed again once measured.
+    policy.record(dataSyncCfg._path, true, 1000, 100, 20ms);
+    EXPECT_TRUE(policy.decide(dataSyncCfg)._level.has_value());
+    EXPECT_EQ(policy.stats()._bytesSaved, 910U);
+}
+
+/*
+ * Test the zstd is chosen with its compression levels.
+ */
+TEST_F(CompressionPolicyTest, ZstdCompression)
+{
+    CompressionPolicy policy{CompressionPolicy::Algorithm::Zstd};
+    auto dataSyncCfg = makeConfig(_testDir.string());
+
+    dataSyncCfg._compression = data_sync::config::Compression::Strong;
+    auto args = CompressionPolicy::rsyncArgs(policy.decide(dataSyncCfg));
+    EXPECT_EQ(args, (std::vector<std::string>{"--compress",
+                                              "--compress-level=19",
+                                              "--compress-choice=zstd"}));
+
+    dataSyncCfg._compression = data_sync::config::Compression::Auto;
+    args = CompressionPolicy::rsyncArgs(policy.decide(dataSyncCfg));
+    ASSERT_EQ(args.size(), 4U);
+    EXPECT_EQ(args[1], "--compress-level=3");
+    EXPECT_EQ(args[2], "--compress-choice=zstd");
+}
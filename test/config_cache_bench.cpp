@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_cache.hpp"
+#include "config_loader.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The microbenchmark of the cold start of the configuration, it
+ *        reports the time to parse the JSON configuration files against
+ *        the time to load them from the config cache.
+ *
+ *        Run it by "meson test --benchmark -C <builddir> --verbose".
+ */
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+using data_sync::config::ConfigCache;
+using data_sync::config::ConfigLoader;
+using data_sync::config::DataSyncConfig;
+
+constexpr std::size_t fileCount = 10;
+constexpr std::size_t cfgsPerFile = 1000;
+constexpr int iterations = 10;
+
+/**
+ * @brief Write the configuration files like the real ones, some of the
+ *        configurations with the destination path and the exclude list.
+ */
+void writeConfigFiles(const fs::path& cfgDir)
+{
+    for (std::size_t file = 0; file < fileCount; ++file)
+    {
+        nlohmann::json cfgFile = {{"Files", nlohmann::json::array()},
+                                  {"Directories", nlohmann::json::array()}};
+        for (std::size_t index = 0; index < cfgsPerFile; ++index)
+        {
+            auto path = "/var/lib/phosphor-data-sync/bench/service" +
+                        std::to_string(file) + "/data" +
+                        std::to_string(index);
+            nlohmann::json cfg = {{"Path", path},
+                                  {"Description", "Config cache bench"},
+                                  {"SyncDirection", "Active2Passive"},
+                                  {"SyncType", "Periodic"},
+                                  {"Periodicity", "PT1M"}};
+            if (index % 2 == 0)
+            {
+                cfg["DestinationPath"] = path + "-dest";
+                cfg["ExcludeFilesList"] = {path + "/cache", path + "/tmp"};
+                cfgFile["Directories"].push_back(cfg);
+            }
+            else
+            {
+                cfgFile["Files"].push_back(cfg);
+            }
+        }
+        std::ofstream(cfgDir / ("bench" + std::to_string(file) + ".json"))
+            << cfgFile;
+    }
+}
+
+/**
+ * @brief Parse all the configuration files as the daemon does without the
+ *        cache.
+ */
+std::vector<std::vector<DataSyncConfig>>
+    parseConfigFiles(const std::vector<data_sync::config::SourceFile>& files)
+{
+    std::vector<std::vector<DataSyncConfig>> dataSyncCfgs(files.size());
+    for (std::size_t index = 0; index < files.size(); ++index)
+    {
+        ConfigLoader::parseFile(files[index]._path, dataSyncCfgs[index]);
+    }
+    return dataSyncCfgs;
+}
+
+template <typename Load>
+void run(std::string_view name, Load load)
+{
+    std::size_t loaded = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        loaded += load();
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime);
+
+    std::cout << name << ": " << elapsed.count() / iterations
+              << " us/load (loaded " << loaded / iterations
+              << " configurations)\n";
+}
+
+} // namespace
+
+int main()
+{
+    char tmpDir[] = "/tmp/pdsCacheBenchXXXXXX";
+    fs::path benchDir = mkdtemp(tmpDir);
+    auto cfgDir = benchDir / "config";
+    fs::create_directories(cfgDir);
+    writeConfigFiles(cfgDir);
+
+    ConfigCache configCache{benchDir / "config.cache"};
+    auto sourceFiles = ConfigCache::getSourceFiles(cfgDir);
+    configCache.store(sourceFiles, parseConfigFiles(sourceFiles));
+
+    std::cout << "Configurations: " << fileCount * cfgsPerFile << " in "
+              << fileCount << " files\n";
+
+    run("parse JSON", [&cfgDir]() {
+        std::size_t count = 0;
+        for (const auto& cfgs :
+             parseConfigFiles(ConfigCache::getSourceFiles(cfgDir)))
+        {
+            count += cfgs.size();
+        }
+        return count;
+    });
+    run("load cache", [&cfgDir, &configCache]() {
+        std::size_t count = 0;
+        auto cachedCfgs =
+            configCache.load(ConfigCache::getSourceFiles(cfgDir));
+        for (const auto& cfgs : cachedCfgs.value_or(
+                 std::vector<std::vector<DataSyncConfig>>{}))
+        {
+            count += cfgs.size();
+        }
+        return count;
+    });
+
+    fs::remove_all(benchDir);
+    return 0;
+}
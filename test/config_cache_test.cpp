@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_cache.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+
+using data_sync::config::ConfigCache;
+using data_sync::config::DataSyncConfig;
+
+class ConfigCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpDir[] = "/tmp/pdsCfgCacheDirXXXXXX";
+        _tmpDir = mkdtemp(tmpDir);
+        _cfgDir = _tmpDir / "config";
+        fs::create_directories(_cfgDir);
+        _cacheFile = _tmpDir / "persist" / "config.cache";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_tmpDir);
+    }
+
+    void writeConfig(const std::string& fileName, const std::string& content)
+    {
+        std::ofstream file(_cfgDir / fileName);
+        file << content;
+    }
+
+    static std::vector<std::vector<DataSyncConfig>>
+        makeConfigs(std::size_t fileCount)
+    {
+        nlohmann::json immediateCfg = {
+            {"Path", "/directory/path/to/sync/"},
+            {"Description", "Config cache test"},
+            {"SyncDirection", "Bidirectional"},
+            {"SyncType", "Immediate"},
+            {"DestinationPath", "/directory/path/to/dest/"},
+            {"ExcludeFilesList", {"/directory/path/to/sync/file1"}},
+            {"RetryAttempts", 2},
+            {"RetryInterval", "PT10S"}};
+
+        nlohmann::json periodicCfg = {{"Path", "/file/path/to/sync"},
+                                      {"Description", "Config cache test"},
+                                      {"SyncDirection", "Active2Passive"},
+                                      {"SyncType", "Periodic"},
+                                      {"Periodicity", "PT1M"}};
+
+        std::vector<std::vector<DataSyncConfig>> dataSyncCfgs(fileCount);
+        dataSyncCfgs[0] = {DataSyncConfig(immediateCfg),
+                           DataSyncConfig(periodicCfg)};
+        return dataSyncCfgs;
+    }
+
+    fs::path _tmpDir;
+    fs::path _cfgDir;
+    fs::path _cacheFile;
+};
+
+/*
+ * Test the stored configurations are loaded as is.
+ */
+TEST_F(ConfigCacheTest, StoreAndLoad)
+{
+    writeConfig("config1.json", R"({"Files": []})");
+    writeConfig("config2.json", R"({"Directories": []})");
+
+    ConfigCache configCache{_cacheFile};
+    auto sourceFiles = ConfigCache::getSourceFiles(_cfgDir);
+    ASSERT_EQ(sourceFiles.size(), 2U);
+    EXPECT_EQ(sourceFiles[0]._path, (_cfgDir / "config1.json").string());
+
+    EXPECT_FALSE(configCache.load(sourceFiles).has_value());
+
+    auto dataSyncCfgs = makeConfigs(2);
+    EXPECT_FALSE(configCache.store(sourceFiles, makeConfigs(1)));
+    ASSERT_TRUE(configCache.store(sourceFiles, dataSyncCfgs));
+
+    auto cachedCfgs = configCache.load(ConfigCache::getSourceFiles(_cfgDir));
+    ASSERT_TRUE(cachedCfgs.has_value());
+    EXPECT_EQ(*cachedCfgs, dataSyncCfgs);
+    EXPECT_EQ((*cachedCfgs)[0][0]._retry, dataSyncCfgs[0][0]._retry);
+    EXPECT_EQ((*cachedCfgs)[0][1]._periodicityInSec,
+              dataSyncCfgs[0][1]._periodicityInSec);
+}
+
+/*
+ * Test the optional fields of the stored configurations are loaded as is.
+ */
+TEST_F(ConfigCacheTest, StoreAndLoadOptionalFields)
+{
+    writeConfig("config1.json", R"({"Files": []})");
+    auto sourceFiles = ConfigCache::getSourceFiles(_cfgDir);
+
+    ConfigCache configCache{_cacheFile};
+
+    // Each field is set to a value other than its default.
+    const std::vector<std::pair<std::string, nlohmann::json>> fields{
+        {"Tier", 1},
+        {"MaxSyncLatency", "PT2S"},
+        {"BandwidthLimit", 2048},
+        {"Compression", "Off"},
+    };
+    for (const auto& [key, value] : fields)
+    {
+        SCOPED_TRACE(key);
+
+        nlohmann::json cfg = {{"Path", "/file/path/to/sync"},
+                              {"Description", "Config cache test"},
+                              {"SyncDirection", "Active2Passive"},
+                              {"SyncType", "Immediate"},
+                              {key, value}};
+        std::vector<std::vector<DataSyncConfig>> dataSyncCfgs{
+            {DataSyncConfig(cfg)}};
+        ASSERT_TRUE(configCache.store(sourceFiles, dataSyncCfgs));
+
+        auto cachedCfgs = configCache.load(sourceFiles);
+        ASSERT_TRUE(cachedCfgs.has_value());
+        EXPECT_EQ(*cachedCfgs, dataSyncCfgs);
+    }
+}
+
+/*
+ * Test the cache is not used once any of the configuration files is changed,
+ * added or removed.
+ */
+TEST_F(ConfigCacheTest, InvalidateOnConfigChange)
+{
+    writeConfig("config1.json", R"({"Files": []})");
+
+    ConfigCache configCache{_cacheFile};
+    ASSERT_TRUE(
+        configCache.store(ConfigCache::getSourceFiles(_cfgDir), makeConfigs(1)));
+    ASSERT_TRUE(
+        configCache.load(ConfigCache::getSourceFiles(_cfgDir)).has_value());
+
+    writeConfig("config1.json", R"({"Files": [ ]})");
+    EXPECT_FALSE(
+        configCache.load(ConfigCache::getSourceFiles(_cfgDir)).has_value());
+
+    ASSERT_TRUE(
+        configCache.store(ConfigCache::getSourceFiles(_cfgDir), makeConfigs(1)));
+    writeConfig("config2.json", R"({"Files": []})");
+    EXPECT_FALSE(
+        configCache.load(ConfigCache::getSourceFiles(_cfgDir)).has_value());
+
+    ASSERT_TRUE(
+        configCache.store(ConfigCache::getSourceFiles(_cfgDir), makeConfigs(2)));
+    fs::remove(_cfgDir / "config2.json");
+    EXPECT_FALSE(
+        configCache.load(ConfigCache::getSourceFiles(_cfgDir)).has_value());
+}
+
+/*
+ * Test the corrupted cache is not used.
+ */
+TEST_F(ConfigCacheTest, IgnoreCorruptedCache)
+{
+    writeConfig("config1.json", R"({"Files": []})");
+    auto sourceFiles = ConfigCache::getSourceFiles(_cfgDir);
+
+    ConfigCache configCache{_cacheFile};
+    ASSERT_TRUE(configCache.store(sourceFiles, makeConfigs(1)));
+
+    auto cacheSize = fs::file_size(_cacheFile);
+    {
+        std::fstream file(_cacheFile,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(cacheSize - 1));
+        file.put('\xff');
+    }
+    EXPECT_FALSE(configCache.load(sourceFiles).has_value());
+
+    fs::resize_file(_cacheFile, cacheSize / 2);
+    EXPECT_FALSE(configCache.load(sourceFiles).has_value());
+}
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_loader.hpp"
+
+#include <sdbusplus/async/context.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+
+using data_sync::config::ConfigLoader;
+using data_sync::config::DataSyncConfig;
+
+class ConfigLoaderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpDir[] = "/tmp/pdsCfgLoaderDirXXXXXX";
+        _cfgDir = mkdtemp(tmpDir);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_cfgDir);
+    }
+
+    std::string writeConfig(const std::string& fileName,
+                            const std::string& content)
+    {
+        auto cfgFile = _cfgDir / fileName;
+        std::ofstream file(cfgFile);
+        file << content;
+        return cfgFile.string();
+    }
+
+    std::string writeFilesConfig(const std::string& fileName,
+                                 const std::vector<std::string>& paths)
+    {
+        nlohmann::json files = nlohmann::json::array();
+        for (const auto& path : paths)
+        {
+            files.push_back({{"Path", path},
+                             {"Description", "Config loader test"},
+                             {"SyncDirection", "Active2Passive"},
+                             {"SyncType", "Immediate"}});
+        }
+        return writeConfig(fileName, nlohmann::json{{"Files", files}}.dump());
+    }
+
+    fs::path _cfgDir;
+};
+
+/*
+ * Test the configuration file is parsed and the invalid file is reported.
+ */
+TEST_F(ConfigLoaderTest, ParseFile)
+{
+    std::vector<DataSyncConfig> dataSyncCfgs;
+    EXPECT_TRUE(ConfigLoader::parseFile(
+        writeFilesConfig("valid.json",
+                         {"/file/path/to/sync1", "/file/path/to/sync2"}),
+        dataSyncCfgs));
+    ASSERT_EQ(dataSyncCfgs.size(), 2U);
+    EXPECT_EQ(dataSyncCfgs[1]._path, "/file/path/to/sync2");
+
+    dataSyncCfgs.clear();
+    EXPECT_FALSE(ConfigLoader::parseFile(
+        writeConfig("invalid.json", R"({"Files": [{"Path": ])"),
+        dataSyncCfgs));
+    EXPECT_TRUE(dataSyncCfgs.empty());
+
+    EXPECT_FALSE(ConfigLoader::parseFile((_cfgDir / "missing.json").string(),
+                                         dataSyncCfgs));
+}
+
+/*
+ * Test the files are parsed on the worker threads and returned in the given
+ * order regardless of the failed file.
+ */
+TEST_F(ConfigLoaderTest, LoadFilesConcurrently)
+{
+    std::vector<std::string> configFiles;
+    std::vector<std::string> expectedPaths;
+    for (int index = 0; index < 8; ++index)
+    {
+        std::vector<std::string> paths;
+        for (int cfg = 0; cfg < 50; ++cfg)
+        {
+            paths.emplace_back("/file" + std::to_string(index) +
+                               "/path/to/sync" + std::to_string(cfg));
+        }
+        expectedPaths.insert(expectedPaths.end(), paths.begin(), paths.end());
+        configFiles.emplace_back(
+            writeFilesConfig("config" + std::to_string(index) + ".json",
+                             paths));
+
+        if (index == 3)
+        {
+            configFiles.emplace_back(
+                writeConfig("invalid.json", R"({"Files": [{"Path": 1}]})"));
+            expectedPaths.emplace_back("invalid");
+        }
+    }
+
+    sdbusplus::async::context ctx;
+    ConfigLoader configLoader{ctx, configFiles, 3};
+
+    data_sync::config::ParsedCfgFiles parsedCfgs;
+
+    auto load =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        parsedCfgs = co_await configLoader.load();
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(load(ctx));
+    ctx.run();
+
+    ASSERT_EQ(parsedCfgs.size(), configFiles.size());
+    std::vector<std::string> parsedPaths;
+    for (const auto& parsedCfg : parsedCfgs)
+    {
+        if (!parsedCfg.has_value())
+        {
+            parsedPaths.emplace_back("invalid");
+            continue;
+        }
+        EXPECT_EQ(parsedCfg->size(), 50U);
+        for (const auto& dataSyncCfg : *parsedCfg)
+        {
+            parsedPaths.emplace_back(dataSyncCfg._path);
+        }
+    }
+    EXPECT_EQ(parsedPaths, expectedPaths);
+}
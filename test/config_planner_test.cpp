@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_planner.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::config::Compression;
+using data_sync::config::ConfigPlanner;
+using data_sync::config::DataSyncConfig;
+using namespace std::literals;
+
+namespace
+{
+
+DataSyncConfig makeConfig(const std::string& path,
+                          const std::string& syncDirection = "Active2Passive",
+                          const std::string& syncType = "Immediate")
+{
+    nlohmann::json config = {{"Path", path},
+                             {"Description", "Config planner test"},
+                             {"SyncDirection", syncDirection},
+                             {"SyncType", syncType}};
+    if (syncType == "Periodic")
+    {
+        config["Periodicity"] = "PT1M";
+    }
+    return {config};
+}
+
+/**
+ * @brief The case of an optional field which the planner merges.
+ */
+struct FieldCase
+{
+    /**
+     * @brief The name of the field.
+     */
+    std::string _name;
+
+    /**
+     * @brief Set the field of each duplicate of a path.
+     */
+    std::vector<std::function<void(DataSyncConfig&)>> _duplicates;
+
+    /**
+     * @brief Whether the duplicates are merged into the expected field.
+     */
+    std::function<bool(const DataSyncConfig&)> _merged;
+
+    /**
+     * @brief Set the field of a directory, and of the paths inside it which
+     *        are kept and dropped as covered by it. The nested paths are not
+     *        planned by the field if not set.
+     */
+    std::function<void(DataSyncConfig&)> _dir;
+    std::function<void(DataSyncConfig&)> _keptNested;
+    std::function<void(DataSyncConfig&)> _droppedNested;
+};
+
+const std::vector<FieldCase> fieldCases{
+    {"Tier",
+     {[](auto& cfg) { cfg._tier = 2; }, [](auto& cfg) { cfg._tier = 1; }},
+     [](const auto& cfg) { return cfg._tier == 1U; },
+     [](auto& cfg) { cfg._tier = 1; },
+     [](auto&) {},
+     [](auto& cfg) { cfg._tier = 3; }},
+    {"MaxSyncLatency",
+     {[](auto& cfg) { cfg._maxSyncLatency = 500ms; }, [](auto&) {}},
+     [](const auto& cfg) { return cfg._maxSyncLatency == 500ms; },
+     [](auto& cfg) { cfg._maxSyncLatency = 2s; },
+     [](auto& cfg) { cfg._maxSyncLatency = 100ms; },
+     [](auto& cfg) { cfg._maxSyncLatency = 5s; }},
+    {"BandwidthLimit",
+     {[](auto&) {}, [](auto& cfg) { cfg._bandwidthLimit = 1024; },
+      [](auto& cfg) { cfg._bandwidthLimit = 256; }},
+     [](const auto& cfg) { return cfg._bandwidthLimit == 256U; },
+     nullptr,
+     nullptr,
+     nullptr},
+    {"Compression",
+     {[](auto& cfg) { cfg._compression = Compression::Fast; },
+      [](auto&) {}},
+     [](const auto& cfg) { return cfg._compression == Compression::Fast; },
+     [](auto&) {},
+     [](auto& cfg) { cfg._compression = Compression::Off; },
+     [](auto&) {}},
+};
+
+} // namespace
+
+/*
+ * Test the identical duplicate configurations are merged into one.
+ */
+TEST(ConfigPlannerTest, MergeIdenticalDuplicates)
+{
+    ConfigPlanner planner{{makeConfig("/file/path/to/sync"),
+                           makeConfig("/file/path/to/sync/"),
+                           makeConfig("/other/file/path/to/sync")}};
+
+    auto plannedCfgs = planner.plan();
+    ASSERT_EQ(plannedCfgs.size(), 2U);
+    EXPECT_EQ(plannedCfgs[0], makeConfig("/file/path/to/sync"));
+    EXPECT_EQ(plannedCfgs[1], makeConfig("/other/file/path/to/sync"));
+}
+
+/*
+ * Test the duplicate configurations are merged to sync the union of
+ * the included data and the common excluded data.
+ */
+TEST(ConfigPlannerTest, MergeFileListsOfDuplicates)
+{
+    auto dirCfg1 = makeConfig("/directory/path/to/sync");
+    dirCfg1._includeFileList = {"/directory/path/to/sync/file1"};
+    dirCfg1._excludeFileList = {"/directory/path/to/sync/file2",
+                                "/directory/path/to/sync/file3"};
+
+    auto dirCfg2 = makeConfig("/directory/path/to/sync");
+    dirCfg2._includeFileList = {"/directory/path/to/sync/file4"};
+    dirCfg2._excludeFileList = {"/directory/path/to/sync/file3"};
+
+    ConfigPlanner planner{{dirCfg1, dirCfg2}};
+
+    auto plannedCfgs = planner.plan();
+    ASSERT_EQ(plannedCfgs.size(), 1U);
+    EXPECT_EQ(plannedCfgs[0]._includeFileList,
+              std::vector<std::string>({"/directory/path/to/sync/file1",
+                                        "/directory/path/to/sync/file4"}));
+    EXPECT_EQ(plannedCfgs[0]._excludeFileList,
+              std::vector<std::string>({"/directory/path/to/sync/file3"}));
+}
+
+/*
+ * Test the path inside a configured directory is dropped if the directory
+ * sync covers it, and kept otherwise.
+ */
+TEST(ConfigPlannerTest, DropNestedPathsCoveredByDirectory)
+{
+    auto dirCfg = makeConfig("/directory/path/to/sync");
+    dirCfg._excludeFileList = {"/directory/path/to/sync/excluded"};
+
+    auto nestedWithOwnDest = makeConfig("/directory/path/to/sync/dest");
+    nestedWithOwnDest._destPath = "/other/destination";
+
+    ConfigPlanner planner{{makeConfig("/directory/path/to/sync/file"), dirCfg,
+                           makeConfig("/directory/path/to/sync/excluded/file"),
+                           nestedWithOwnDest,
+                           makeConfig("/directory/path/to/sync2/file")}};
+
+    auto plannedCfgs = planner.plan();
+    ASSERT_EQ(plannedCfgs.size(), 4U);
+    EXPECT_EQ(plannedCfgs[0]._path, "/directory/path/to/sync");
+    EXPECT_EQ(plannedCfgs[1]._path, "/directory/path/to/sync/excluded/file");
+    EXPECT_EQ(plannedCfgs[2]._path, "/directory/path/to/sync/dest");
+    EXPECT_EQ(plannedCfgs[3]._path, "/directory/path/to/sync2/file");
+}
+
+/*
+ * Test the overlapping paths with the conflicting sync direction or type
+ * are kept.
+ */
+TEST(ConfigPlannerTest, KeepConflictingOverlaps)
+{
+    ConfigPlanner planner{
+        {makeConfig("/directory/path/to/sync"),
+         makeConfig("/directory/path/to/sync", "Passive2Active"),
+         makeConfig("/directory/path/to/sync/file", "Bidirectional"),
+         makeConfig("/directory/path/to/sync/periodic", "Active2Passive",
+                    "Periodic")}};
+
+    EXPECT_EQ(planner.plan().size(), 4U);
+}
+
+/*
+ * Test the periodic path inside a periodic directory is dropped only if
+ * the directory is synced at least as often.
+ */
+TEST(ConfigPlannerTest, NestedPeriodicity)
+{
+    auto dirCfg = makeConfig("/directory/path/to/sync", "Active2Passive",
+                             "Periodic");
+    auto slowerCfg = makeConfig("/directory/path/to/sync/slower",
+                                "Active2Passive", "Periodic");
+    slowerCfg._periodicityInSec = std::chrono::seconds(120);
+    auto fasterCfg = makeConfig("/directory/path/to/sync/faster",
+                                "Active2Passive", "Periodic");
+    fasterCfg._periodicityInSec = std::chrono::seconds(10);
+
+    ConfigPlanner planner{{dirCfg, slowerCfg, fasterCfg}};
+
+    auto plannedCfgs = planner.plan();
+    ASSERT_EQ(plannedCfgs.size(), 2U);
+    EXPECT_EQ(plannedCfgs[1]._path, "/directory/path/to/sync/faster");
+}
+
+/*
+ * Test the duplicates are merged into the strictest value of each optional
+ * field.
+ */
+TEST(ConfigPlannerTest, MergeDuplicateFields)
+{
+    for (const auto& fieldCase : fieldCases)
+    {
+        SCOPED_TRACE(fieldCase._name);
+
+        std::vector<DataSyncConfig> dataSyncCfgs;
+        for (const auto& setField : fieldCase._duplicates)
+        {
+            auto& fileCfg =
+                dataSyncCfgs.emplace_back(makeConfig("/file/path/to/sync"));
+            setField(fileCfg);
+        }
+
+        ConfigPlanner planner{dataSyncCfgs};
+
+        auto plannedCfgs = planner.plan();
+        ASSERT_EQ(plannedCfgs.size(), 1U);
+        EXPECT_TRUE(fieldCase._merged(plannedCfgs[0]));
+    }
+}
+
+/*
+ * Test the path inside a directory is kept if it is planned otherwise by an
+ * optional field, like to sync it sooner, and dropped if not.
+ */
+TEST(ConfigPlannerTest, NestedFields)
+{
+    for (const auto& fieldCase : fieldCases)
+    {
+        if (!fieldCase._dir)
+        {
+            continue;
+        }
+        SCOPED_TRACE(fieldCase._name);
+
+        auto dirCfg = makeConfig("/directory/path/to/sync");
+        fieldCase._dir(dirCfg);
+        auto keptCfg = makeConfig("/directory/path/to/sync/kept");
+        fieldCase._keptNested(keptCfg);
+        auto droppedCfg = makeConfig("/directory/path/to/sync/dropped");
+        fieldCase._droppedNested(droppedCfg);
+
+        ConfigPlanner planner{{dirCfg, keptCfg, droppedCfg}};
+
+        auto plannedCfgs = planner.plan();
+        ASSERT_EQ(plannedCfgs.size(), 2U);
+        EXPECT_EQ(plannedCfgs[0]._path, "/directory/path/to/sync");
+        EXPECT_EQ(plannedCfgs[1]._path, "/directory/path/to/sync/kept");
+    }
+}
+
+/*
+ * Test the directory which is merged away into its duplicate doesn't cover
+ * the nested path, only the merged directory does.
+ */
+TEST(ConfigPlannerTest, NestedPathOfMergedDuplicate)
+{
+    auto fastDirCfg = makeConfig("/directory/path/to/sync");
+    fastDirCfg._compression = Compression::Fast;
+    auto strongDirCfg = makeConfig("/directory/path/to/sync");
+    strongDirCfg._compression = Compression::Strong;
+    auto fastCfg = makeConfig("/directory/path/to/sync/fast");
+    fastCfg._compression = Compression::Fast;
+
+    ConfigPlanner planner{{strongDirCfg, fastDirCfg, fastCfg}};
+
+    auto plannedCfgs = planner.plan();
+    ASSERT_EQ(plannedCfgs.size(), 2U);
+    EXPECT_EQ(plannedCfgs[0]._path, "/directory/path/to/sync");
+    EXPECT_EQ(plannedCfgs[0]._compression, Compression::Strong);
+    EXPECT_EQ(plannedCfgs[1]._path, "/directory/path/to/sync/fast");
+    EXPECT_EQ(plannedCfgs[1]._compression, Compression::Fast);
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_store.hpp"
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The microbenchmark of the config store against the plain vector of
+ *        the configurations, it reports the memory used per configuration
+ *        and the lookup time with 10k configurations.
+ *
+ *        Run it by "meson test --benchmark -C <builddir> --verbose".
+ */
+
+namespace
+{
+
+using data_sync::config::ConfigStore;
+using data_sync::config::DataSyncConfig;
+
+constexpr std::size_t cfgCount = 10000;
+
+/**
+ * @brief Get the bytes allocated from the heap and not freed yet, including
+ *        the large allocations which are mapped separately.
+ */
+std::size_t allocatedBytes()
+{
+    auto mallocInfo = mallinfo2();
+    return mallocInfo.uordblks + mallocInfo.hblkhd;
+}
+
+/**
+ * @brief Make the configurations which share the parent directories like the
+ *        real configuration files, some of them with the destination path
+ *        and the exclude list.
+ */
+std::vector<DataSyncConfig> makeConfigs()
+{
+    std::vector<DataSyncConfig> dataSyncCfgs;
+    dataSyncCfgs.reserve(cfgCount);
+    for (std::size_t index = 0; index < cfgCount; ++index)
+    {
+        auto dir = "/var/lib/phosphor-data-sync/bench/service" +
+                   std::to_string(index / 100);
+        auto path = dir + "/data" + std::to_string(index) + "/";
+
+        nlohmann::json cfg = {{"Path", path},
+                              {"Description", "Config store bench"},
+                              {"SyncDirection", "Active2Passive"},
+                              {"SyncType", "Immediate"}};
+        if (index % 2 == 0)
+        {
+            cfg["DestinationPath"] = dir + "/dest" + std::to_string(index) +
+                                     "/";
+        }
+        if (index % 4 == 0)
+        {
+            cfg["ExcludeFilesList"] = {path + "cache", path + "tmp"};
+        }
+        dataSyncCfgs.emplace_back(cfg);
+    }
+    return dataSyncCfgs;
+}
+
+template <typename Lookup>
+void run(std::string_view name, const std::vector<DataSyncConfig>& queries,
+         Lookup lookup)
+{
+    constexpr int iterations = 10;
+
+    std::size_t found = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        for (const auto& query : queries)
+        {
+            found += lookup(query) ? 1 : 0;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime);
+
+    std::cout << name << ": "
+              << elapsed.count() / (iterations * queries.size())
+              << " ns/lookup (found " << found << ")\n";
+}
+
+} // namespace
+
+int main()
+{
+    auto baseBytes = allocatedBytes();
+    auto dataSyncCfgs = makeConfigs();
+    auto vectorBytes = allocatedBytes() - baseBytes;
+
+    auto queries = dataSyncCfgs;
+    std::ranges::reverse(queries);
+    queries.resize(1000);
+
+    baseBytes = allocatedBytes();
+    ConfigStore configStore{makeConfigs()};
+    auto storeBytes = allocatedBytes() - baseBytes;
+
+    std::cout << "Configurations: " << cfgCount << "\n"
+              << "vector: " << vectorBytes << " bytes ("
+              << vectorBytes / cfgCount << " bytes/config)\n"
+              << "config store: " << storeBytes << " bytes ("
+              << storeBytes / cfgCount << " bytes/config)\n";
+
+    run("vector contains", queries, [&dataSyncCfgs](const auto& query) {
+        return std::ranges::contains(dataSyncCfgs, query);
+    });
+    run("config store contains", queries, [&configStore](const auto& query) {
+        return configStore.contains(query);
+    });
+    return 0;
+}
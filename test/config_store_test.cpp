@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_store.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::config::ConfigStore;
+using data_sync::config::DataSyncConfig;
+using data_sync::config::SyncDirection;
+using data_sync::config::SyncType;
+
+namespace
+{
+
+DataSyncConfig makeConfig(const std::string& path,
+                          const std::string& syncDirection,
+                          const std::string& syncType,
+                          const std::string& destPath = "")
+{
+    nlohmann::json cfg = {{"Path", path},
+                          {"Description", "Config store test"},
+                          {"SyncDirection", syncDirection},
+                          {"SyncType", syncType}};
+    if (syncType == "Periodic")
+    {
+        cfg["Periodicity"] = "PT1M";
+    }
+    if (!destPath.empty())
+    {
+        cfg["DestinationPath"] = destPath;
+    }
+    return DataSyncConfig(cfg);
+}
+
+} // namespace
+
+/*
+ * Test the configurations are found by the path, destination path and
+ * the sync mode.
+ */
+TEST(ConfigStoreTest, FindConfigs)
+{
+    ConfigStore configStore{std::vector<DataSyncConfig>{
+        makeConfig("/file/path/to/sync1", "Active2Passive", "Immediate"),
+        makeConfig("/file/path/to/sync2", "Bidirectional", "Periodic",
+                   "/file/path/to/dest2"),
+        makeConfig("/file/path/to/sync2", "Passive2Active", "Immediate")}};
+
+    ASSERT_EQ(configStore.size(), 3U);
+    EXPECT_TRUE(configStore.contains(
+        makeConfig("/file/path/to/sync1", "Active2Passive", "Immediate")));
+    EXPECT_FALSE(configStore.contains(
+        makeConfig("/file/path/to/sync1", "Bidirectional", "Immediate")));
+
+    EXPECT_EQ(configStore.findByPath("/file/path/to/sync2").size(), 2U);
+    EXPECT_TRUE(configStore.findByPath("/file/path/to/sync3").empty());
+
+    auto destCfgs = configStore.findByDestPath("/file/path/to/dest2");
+    ASSERT_EQ(destCfgs.size(), 1U);
+    EXPECT_EQ(configStore[destCfgs[0]]._syncType, SyncType::Periodic);
+    EXPECT_EQ(configStore.findByDestPath("/file/path/to/sync1").size(), 1U);
+
+    EXPECT_EQ(configStore
+                  .findBySyncMode(SyncType::Immediate,
+                                  SyncDirection::Passive2Active)
+                  .size(),
+              1U);
+    EXPECT_TRUE(
+        configStore
+            .findBySyncMode(SyncType::Periodic, SyncDirection::Active2Passive)
+            .empty());
+}
+
+/*
+ * Test the configurations are restored from the compact records as is.
+ */
+TEST(ConfigStoreTest, RestoreConfigs)
+{
+    nlohmann::json cfg = {
+        {"Path", "/directory/path/to/sync/"},
+        {"Description", "Config store test"},
+        {"SyncDirection", "Passive2Active"},
+        {"SyncType", "Periodic"},
+        {"Periodicity", "PT1H"},
+        {"DestinationPath", "/directory/path/to/dest/"},
+        {"RetryAttempts", 3},
+        {"RetryInterval", "PT10S"},
+        {"ExcludeFilesList",
+         {"/directory/path/to/sync/file1", "/directory/path/to/sync/file2"}},
+        {"IncludeFilesList", nlohmann::json::array()},
+        {"Tier", 4},
+        {"MaxSyncLatency", "PT0.25S"},
+        {"BandwidthLimit", 128},
+        {"Compression", "Fast"}};
+
+    std::vector<DataSyncConfig> dataSyncCfgs{
+        DataSyncConfig(cfg),
+        makeConfig("/file/path/to/sync", "Bidirectional", "Immediate")};
+
+    ConfigStore configStore{dataSyncCfgs};
+    ASSERT_EQ(configStore.size(), dataSyncCfgs.size());
+    for (std::size_t index = 0; index < dataSyncCfgs.size(); ++index)
+    {
+        EXPECT_EQ(configStore[index], dataSyncCfgs[index]);
+        EXPECT_EQ(configStore[index]._retry, dataSyncCfgs[index]._retry);
+        EXPECT_TRUE(configStore.matches(index, dataSyncCfgs[index]));
+    }
+    EXPECT_FALSE(configStore.matches(0, dataSyncCfgs[1]));
+
+    // The empty list is not same as the list which is not configured.
+    cfg.erase("IncludeFilesList");
+    EXPECT_FALSE(configStore.contains(DataSyncConfig(cfg)));
+
+    cfg["ExcludeFilesList"] = {"/directory/path/to/sync/file1"};
+    EXPECT_FALSE(configStore.contains(DataSyncConfig(cfg)));
+
+    EXPECT_EQ(configStore.tier(0), 4U);
+    cfg["IncludeFilesList"] = nlohmann::json::array();
+    cfg["ExcludeFilesList"] = {"/directory/path/to/sync/file1",
+                               "/directory/path/to/sync/file2"};
+    EXPECT_TRUE(configStore.contains(DataSyncConfig(cfg)));
+
+    // The configuration is not found once any of its optional fields is
+    // changed or not configured, the field is removed if the value is null.
+    const std::vector<std::pair<std::string, nlohmann::json>> fieldChanges{
+        {"Tier", 5},
+        {"Tier", nullptr},
+        {"MaxSyncLatency", "PT1S"},
+        {"MaxSyncLatency", nullptr},
+        {"BandwidthLimit", 256},
+        {"BandwidthLimit", nullptr},
+        {"Compression", "Strong"},
+        {"Compression", nullptr},
+    };
+    for (const auto& [key, value] : fieldChanges)
+    {
+        SCOPED_TRACE(key + ": " + value.dump());
+
+        auto changedCfg = cfg;
+        if (value.is_null())
+        {
+            changedCfg.erase(key);
+        }
+        else
+        {
+            changedCfg[key] = value;
+        }
+        EXPECT_FALSE(configStore.contains(DataSyncConfig(changedCfg)));
+    }
+}
+
+/*
+ * Test the indexes are updated once the configurations are added and removed.
+ */
+TEST(ConfigStoreTest, AddAndRemoveConfigs)
+{
+    ConfigStore configStore;
+
+    auto cfg1 = makeConfig("/file/path/to/sync1", "Active2Passive",
+                           "Immediate");
+    auto cfg2 = makeConfig("/file/path/to/sync2", "Active2Passive",
+                           "Immediate");
+    auto cfg3 = makeConfig("/file/path/to/sync3", "Bidirectional", "Periodic");
+
+    EXPECT_EQ(configStore.add(cfg1), 0U);
+    EXPECT_EQ(configStore.add(cfg2), 1U);
+    EXPECT_EQ(configStore.add(cfg3), 2U);
+
+    EXPECT_TRUE(configStore.remove(cfg1));
+    EXPECT_FALSE(configStore.remove(cfg1));
+    EXPECT_FALSE(configStore.contains(cfg1));
+
+    // The last configuration is moved into the removed place.
+    ASSERT_EQ(configStore.size(), 2U);
+    EXPECT_EQ(configStore[0], cfg3);
+    EXPECT_EQ(configStore.findByPath(cfg3._path),
+              std::vector<std::size_t>{0});
+    EXPECT_EQ(configStore.findBySyncMode(SyncType::Immediate,
+                                         SyncDirection::Active2Passive),
+              std::vector<std::uint32_t>{1});
+
+    EXPECT_TRUE(configStore.remove(cfg3));
+    EXPECT_TRUE(configStore.remove(cfg2));
+    EXPECT_TRUE(configStore.empty());
+    EXPECT_TRUE(configStore.findByDestPath(cfg2._path).empty());
+}
@@ -8,7 +8,10 @@
 
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -142,7 +145,8 @@ TEST(DataSyncConfigParserTest, TestImmediateAndBidirectionalDirectorySync)
 
 /*
  * Test when the input JSON contains the details of the file to be synced
- * periodically where periodicity is not in expected format of 'PTxHxMxS'
+ * periodically where periodicity is not in supported format of 'PnW' or
+ * 'PnDTnHnMnS'
  * Hence Periodicity will set to the default value of 60 seconds.
  */
 TEST(DataSyncConfigParserTest, TestFileSyncWithInvalidPeriodicity)
@@ -154,7 +158,7 @@ TEST(DataSyncConfigParserTest, TestFileSyncWithInvalidPeriodicity)
             "Description": "Add details about the data and purpose of the synchronization",
             "SyncDirection": "Active2Passive",
             "SyncType": "Periodic",
-            "Periodicity": "P1D",
+            "Periodicity": "P1Y",
             "RetryAttempts": 1,
             "RetryInterval": "PT1M"
         }
@@ -178,7 +182,7 @@ TEST(DataSyncConfigParserTest, TestFileSyncWithInvalidPeriodicity)
 
 /*
  * Test when the input JSON contains the details of the file to be synced
- * where RetryInterval is not in expected format of 'PTxHxMxS'
+ * where RetryInterval is not in supported format of 'PnW' or 'PnDTnHnMnS'
  * Hence retryInterval will set to the default value as defined in config.h.
  */
 TEST(DataSyncConfigParserTest, TestFileSyncWithInvalidRetryInterval)
@@ -192,7 +196,7 @@ TEST(DataSyncConfigParserTest, TestFileSyncWithInvalidRetryInterval)
             "SyncType": "Periodic",
             "Periodicity": "PT30S",
             "RetryAttempts": 1,
-            "RetryInterval": "P1D"
+            "RetryInterval": "P1Y"
         }
 
     )"_json;
@@ -305,3 +309,88 @@ TEST(DataSyncConfigParserTest, TestFileSyncWithValidDestination)
     EXPECT_EQ(dataSyncConfig._excludeFileList, std::nullopt);
     EXPECT_EQ(dataSyncConfig._includeFileList, std::nullopt);
 }
+
+/*
+ * Test the optional fields of the data, each of them is defaulted if not
+ * configured and the unsupported value is ignored or limited.
+ */
+TEST(DataSyncConfigParserTest, TestFileSyncOptionalFields)
+{
+    using data_sync::config::Compression;
+    using data_sync::config::criticalTier;
+    using data_sync::config::DataSyncConfig;
+    using data_sync::config::maxTier;
+    using namespace std::literals;
+
+    struct FieldCase
+    {
+        // The configured field, not configured if the value is null.
+        std::string _key;
+        nlohmann::json _value;
+
+        // Whether the field is parsed as expected.
+        std::function<bool(const DataSyncConfig&)> _parsed;
+
+        // Whether it is parsed same as the field is not configured.
+        bool _defaulted;
+    };
+
+    const std::vector<FieldCase> fieldCases{
+        {"Tier", nullptr,
+         [](const auto& cfg) { return cfg._tier == criticalTier; }, true},
+        {"Tier", 3, [](const auto& cfg) { return cfg._tier == 3U; }, false},
+        {"Tier", 100,
+         [](const auto& cfg) { return cfg._tier == maxTier; }, false},
+        {"MaxSyncLatency", nullptr,
+         [](const auto& cfg) { return !cfg._maxSyncLatency.has_value(); },
+         true},
+        {"MaxSyncLatency", "PT0.25S",
+         [](const auto& cfg) { return cfg._maxSyncLatency == 250ms; }, false},
+        {"MaxSyncLatency", "0.25S",
+         [](const auto& cfg) { return !cfg._maxSyncLatency.has_value(); },
+         true},
+        {"BandwidthLimit", nullptr,
+         [](const auto& cfg) { return !cfg._bandwidthLimit.has_value(); },
+         true},
+        {"BandwidthLimit", 512,
+         [](const auto& cfg) { return cfg._bandwidthLimit == 512U; }, false},
+        {"BandwidthLimit", 0,
+         [](const auto& cfg) { return !cfg._bandwidthLimit.has_value(); },
+         true},
+        {"Compression", nullptr,
+         [](const auto& cfg) { return cfg._compression == Compression::Auto; },
+         true},
+        {"Compression", "Off",
+         [](const auto& cfg) { return cfg._compression == Compression::Off; },
+         false},
+        {"Compression", "Medium",
+         [](const auto& cfg) { return cfg._compression == Compression::Auto; },
+         true},
+    };
+
+    const auto configJSON = R"(
+        {
+            "Path": "/file/path/to/sync",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Immediate"
+        }
+    )"_json;
+    const DataSyncConfig defaultConfig(configJSON);
+
+    for (const auto& fieldCase : fieldCases)
+    {
+        SCOPED_TRACE(fieldCase._key + ": " + fieldCase._value.dump());
+
+        auto fieldJSON = configJSON;
+        if (!fieldCase._value.is_null())
+        {
+            fieldJSON[fieldCase._key] = fieldCase._value;
+        }
+        DataSyncConfig dataSyncConfig(fieldJSON);
+
+        EXPECT_TRUE(fieldCase._parsed(dataSyncConfig));
+        EXPECT_EQ(dataSyncConfig == defaultConfig, fieldCase._defaulted);
+    }
+}
+
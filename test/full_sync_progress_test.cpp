@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "full_sync_progress.hpp"
+
+#include <gtest/gtest.h>
+
+using data_sync::FullSyncProgressTracker;
+using namespace std::literals;
+
+/*
+ * Test the progress is emitted with the throughput and the ETA.
+ */
+TEST(FullSyncProgressTest, EmitProgress)
+{
+    FullSyncProgressTracker tracker{1s};
+    auto startTime = FullSyncProgressTracker::Clock::now();
+    tracker.start(4, false, startTime);
+    EXPECT_EQ(tracker.nextEmitTime(), startTime + 1s);
+
+    const auto& started = tracker.emit(startTime);
+    EXPECT_EQ(started._totalCount, 4U);
+    EXPECT_EQ(started._syncedCount, 0U);
+    EXPECT_FALSE(started._eta.has_value());
+
+    tracker.transferred(2000);
+    tracker.synced();
+    tracker.emit(startTime + 2s);
+
+    // The emitted progress is not changed until the next emission.
+    tracker.transferred(1000);
+    tracker.synced();
+    const auto& progress = tracker.emitted();
+    EXPECT_EQ(progress._syncedCount, 1U);
+    EXPECT_EQ(progress._transferredBytes, 2000U);
+    EXPECT_EQ(progress._throughput, 1000U);
+    EXPECT_EQ(progress._eta, 6s);
+    EXPECT_EQ(tracker.nextEmitTime(), startTime + 3s);
+
+    tracker.emit(startTime + 4s);
+    EXPECT_EQ(progress._syncedCount, 2U);
+    EXPECT_EQ(progress._transferredBytes, 3000U);
+    EXPECT_EQ(progress._throughput, 750U);
+    EXPECT_EQ(progress._eta, 4s);
+    EXPECT_EQ(tracker.emitCount(), 3U);
+}
+
+/*
+ * Test the paths skipped while resuming are not counted to estimate.
+ */
+TEST(FullSyncProgressTest, ResumedProgress)
+{
+    FullSyncProgressTracker tracker{1s};
+    auto startTime = FullSyncProgressTracker::Clock::now();
+    tracker.start(4, true, startTime);
+
+    tracker.skipped();
+    tracker.skipped();
+    EXPECT_FALSE(tracker.emit(startTime + 1s)._eta.has_value());
+
+    tracker.synced();
+    const auto& progress = tracker.emit(startTime + 3s);
+    EXPECT_TRUE(progress._resumed);
+    EXPECT_EQ(progress._syncedCount, 3U);
+    EXPECT_EQ(progress._eta, 3s);
+
+    // A new full sync starts over.
+    tracker.start(2, false, startTime + 4s);
+    EXPECT_FALSE(tracker.emitted()._resumed);
+    EXPECT_EQ(tracker.emitted()._syncedCount, 0U);
+    EXPECT_EQ(tracker.emitCount(), 0U);
+}
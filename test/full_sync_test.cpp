@@ -2,8 +2,14 @@
 
 #include "manager_test.hpp"
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <sstream>
+
 std::filesystem::path ManagerTest::dataSyncCfgDir;
 std::filesystem::path ManagerTest::tmpDataSyncDataDir;
+std::filesystem::path ManagerTest::dataSyncPersistDir;
 
 using FullSyncStatus = sdbusplus::common::xyz::openbmc_project::control::
     SyncBMCData::FullSyncStatus;
@@ -125,7 +131,8 @@ TEST_F(ManagerTest, FullSyncA2PTest)
     ASSERT_EQ(ManagerTest::readData(srcFile4), data4);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     auto waitingForFullSyncToFinish =
         // NOLINTNEXTLINE
@@ -282,7 +289,8 @@ TEST_F(ManagerTest, FullSyncP2ATest)
     ASSERT_EQ(ManagerTest::readData(srcFile4), data4);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     auto waitingForFullSyncToFinish =
         // NOLINTNEXTLINE
@@ -432,7 +440,8 @@ TEST_F(ManagerTest, FullSyncInProgressTest)
     ASSERT_EQ(ManagerTest::readData(srcFile4), data4);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     auto waitingForFullSyncToFinish =
         // NOLINTNEXTLINE
@@ -557,7 +566,8 @@ TEST_F(ManagerTest, FullSyncFailed)
     // ASSERT_EQ(ManagerTest::readData(srcFile4), data4);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     auto waitingForFullSyncToFinish =
         // NOLINTNEXTLINE
@@ -589,3 +599,775 @@ TEST_F(ManagerTest, FullSyncFailed)
 
     ctx.run();
 }
+
+/*
+ * Test the interrupted full sync is resumed by skipping the data which is
+ * already synced and not changed since then.
+ */
+TEST_F(ManagerTest, FullSyncResumeTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    auto makeExtDataIfaces = []() {
+        auto extDataIface = std::make_unique<ed::MockExternalDataIFaces>();
+        auto* mockExtDataIfaces = extDataIface.get();
+
+        ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+            // NOLINTNEXTLINE
+            .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+            mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+            mockExtDataIfaces->setBMCRedundancy(true);
+            co_return;
+        });
+
+        EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+            // NOLINTNEXTLINE
+            .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+        EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+            // NOLINTNEXTLINE
+            .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+        return std::unique_ptr<ed::ExternalDataIFaces>(std::move(extDataIface));
+    };
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile7"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile7"},
+           {"Description", "FullSync resume test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1H"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile8"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile8"},
+           {"Description", "FullSync resume test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1H"}}}}};
+
+    std::string srcFile7{jsonData["Files"][0]["Path"]};
+    std::string destFile7{jsonData["Files"][0]["DestinationPath"]};
+    std::string srcFile8{jsonData["Files"][1]["Path"]};
+    std::string destFile8{jsonData["Files"][1]["DestinationPath"]};
+
+    writeConfig(jsonData);
+
+    // The full sync fails as the second source doesn't exist yet.
+    std::string data{"Data written on the file\n"};
+    ManagerTest::writeData(srcFile7, data);
+    {
+        sdbusplus::async::context ctx;
+        data_sync::Manager manager{ctx, makeExtDataIfaces(),
+                                   ManagerTest::dataSyncCfgDir,
+                                   ManagerTest::dataSyncPersistDir};
+
+        ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+                  sdbusplus::async::execution::then(
+                      [&ctx]() { ctx.request_stop(); }));
+        ctx.run();
+
+        EXPECT_EQ(manager.getFullSyncStatus(), FullSyncStatus::FullSyncFailed);
+        EXPECT_EQ(ManagerTest::readData(destFile7), data);
+        EXPECT_FALSE(manager.getFullSyncProgress()._resumed);
+    }
+
+    // Remove the synced data on the destination to detect whether it is
+    // synced again.
+    std::filesystem::remove(destFile7);
+    ManagerTest::writeData(srcFile8, data);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, makeExtDataIfaces(),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 0.5s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(manager.getFullSyncStatus(), FullSyncStatus::FullSyncCompleted);
+    EXPECT_TRUE(manager.getFullSyncProgress()._resumed);
+    EXPECT_EQ(manager.getFullSyncProgress()._syncedCount, 2U);
+    EXPECT_EQ(manager.getFullSyncProgress()._totalCount, 2U);
+    EXPECT_EQ(manager.getFullSyncProgress()._transferredBytes, data.size());
+    EXPECT_EQ(manager.getFullSyncProgress()._eta, 0s);
+    EXPECT_FALSE(std::filesystem::exists(destFile7))
+        << "The unchanged data which is synced before the interruption "
+        << "should not be synced again.";
+    EXPECT_EQ(ManagerTest::readData(destFile8), data);
+}
+
+/*
+ * Test the full sync of a path prefix syncs only the data under it and
+ * restores the full sync status once completed.
+ */
+TEST_F(ManagerTest, FullSyncScopeTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(false);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    auto scopeDir = ManagerTest::tmpDataSyncDataDir / "scopeDir";
+    auto otherDir = ManagerTest::tmpDataSyncDataDir / "otherDir";
+    std::filesystem::create_directory(scopeDir);
+    std::filesystem::create_directory(otherDir);
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", (scopeDir / "srcFile").string()},
+           {"DestinationPath", (scopeDir / "destFile").string()},
+           {"Description", "FullSync scope test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}},
+          {{"Path", (otherDir / "srcFile").string()},
+           {"DestinationPath", (otherDir / "destFile").string()},
+           {"Description", "FullSync scope test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    writeConfig(jsonData);
+
+    std::string data{"Data written on the file\n"};
+    ManagerTest::writeData(scopeDir / "srcFile", data);
+    ManagerTest::writeData(otherDir / "srcFile", data);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    auto syncScope =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        co_await sdbusplus::async::sleep_for(ctx, 0.1s);
+
+        // Nothing to cancel as no full sync is in progress.
+        EXPECT_FALSE(manager.cancelFullSync());
+
+        auto status = manager.getFullSyncStatus();
+        data_sync::FullSyncScope scope;
+        scope._pathPrefix = scopeDir.string();
+        co_await manager.startFullSync(scope);
+
+        EXPECT_EQ(manager.getFullSyncStatus(), status);
+        EXPECT_EQ(manager.getFullSyncProgress()._totalCount, 1U);
+        EXPECT_EQ(ManagerTest::readData(scopeDir / "destFile"), data);
+        EXPECT_FALSE(std::filesystem::exists(otherDir / "destFile"));
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(syncScope(ctx));
+    ctx.run();
+}
+
+/*
+ * Test the full sync syncs the tiers in order and sets the status of each
+ * tier.
+ */
+TEST_F(ManagerTest, FullSyncTierTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/bulkFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/bulkDestFile"},
+           {"Description", "FullSync tier test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"Tier", 2}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/criticalFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/criticalDestFile"},
+           {"Description", "FullSync tier test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"BandwidthLimit", 100}}}}};
+
+    std::string bulkFile{jsonData["Files"][0]["Path"]};
+    std::string bulkDestFile{jsonData["Files"][0]["DestinationPath"]};
+    std::string criticalFile{jsonData["Files"][1]["Path"]};
+    std::string criticalDestFile{jsonData["Files"][1]["DestinationPath"]};
+
+    writeConfig(jsonData);
+
+    // The bandwidth limit keeps the critical tier syncing for about a
+    // second while the bulk tier is synced right away once started.
+    std::string data{"Data written on the file\n"};
+    std::string criticalData(100 * 1024, 'x');
+    ManagerTest::writeData(bulkFile, data);
+    ManagerTest::writeData(criticalFile, criticalData);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+              sdbusplus::async::execution::then([&manager]() {
+        std::map<std::uint8_t, FullSyncStatus> tierStatus{
+            {data_sync::config::criticalTier,
+             FullSyncStatus::FullSyncInProgress},
+            {2, FullSyncStatus::FullSyncNotStarted}};
+        EXPECT_EQ(manager.getFullSyncTierStatus(), tierStatus)
+            << "The bulk tier should not start before the critical tier is "
+            << "completed.";
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 2.5s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(manager.getFullSyncStatus(), FullSyncStatus::FullSyncCompleted);
+    std::map<std::uint8_t, FullSyncStatus> tierStatus{
+        {data_sync::config::criticalTier, FullSyncStatus::FullSyncCompleted},
+        {2, FullSyncStatus::FullSyncCompleted}};
+    EXPECT_EQ(manager.getFullSyncTierStatus(), tierStatus);
+    EXPECT_EQ(ManagerTest::readData(criticalDestFile), criticalData);
+    EXPECT_EQ(ManagerTest::readData(bulkDestFile), data);
+
+    // The destination is changed last once its transfer is finished, the
+    // bulk tier is started only after the critical tier is finished.
+    struct stat criticalStat{};
+    struct stat bulkStat{};
+    ASSERT_EQ(stat(criticalDestFile.c_str(), &criticalStat), 0);
+    ASSERT_EQ(stat(bulkDestFile.c_str(), &bulkStat), 0);
+    EXPECT_LE(std::chrono::seconds(criticalStat.st_ctim.tv_sec) +
+                  std::chrono::nanoseconds(criticalStat.st_ctim.tv_nsec),
+              std::chrono::seconds(bulkStat.st_ctim.tv_sec) +
+                  std::chrono::nanoseconds(bulkStat.st_ctim.tv_nsec));
+}
+
+/*
+ * Test the full sync is started once the BMC redundancy is enabled at
+ * runtime as the data is not synced while it is disabled.
+ */
+TEST_F(ManagerTest, FullSyncRedundancyEnabledTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(false);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile"},
+           {"Description", "FullSync redundancy test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string srcFile{jsonData["Files"][0]["Path"]};
+    std::string destFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+
+    std::string data{"Data written on the file\n"};
+    ManagerTest::writeData(srcFile, data);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.2s) |
+              sdbusplus::async::execution::then(
+                  [&mockExtDataIfaces, &manager, &destFile, &data]() {
+        EXPECT_NE(manager.getFullSyncStatus(),
+                  FullSyncStatus::FullSyncCompleted)
+            << "The full sync should not run without the redundancy.";
+        EXPECT_NE(ManagerTest::readData(destFile), data);
+        mockExtDataIfaces->changeBMCRedundancy(true);
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 0.7s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(manager.getFullSyncStatus(), FullSyncStatus::FullSyncCompleted)
+        << "The full sync should run once the redundancy is enabled.";
+    EXPECT_EQ(ManagerTest::readData(destFile), data);
+}
+
+/*
+ * Test the full sync in progress is cancelled once the BMC role is switched
+ * as the data of the previous role is not synced anymore.
+ */
+TEST_F(ManagerTest, FullSyncRoleSwitchCancelTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The bandwidth limit keeps the transfer running for a while.
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/largeFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/largeDestFile"},
+           {"Description", "FullSync role switch test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"BandwidthLimit", 100}}}}};
+
+    std::string largeFile{jsonData["Files"][0]["Path"]};
+    std::string largeDestFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    ManagerTest::writeData(largeFile, std::string(2 * 1024 * 1024, 'x'));
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.3s) |
+              sdbusplus::async::execution::then(
+                  [&mockExtDataIfaces, &manager]() {
+        EXPECT_EQ(manager.getFullSyncStatus(),
+                  FullSyncStatus::FullSyncInProgress);
+        mockExtDataIfaces->changeBMCRole(ed::BMCRole::Passive);
+    }));
+
+    auto statusAfterSwitch = FullSyncStatus::FullSyncNotStarted;
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.8s) |
+              sdbusplus::async::execution::then(
+                  [&manager, &statusAfterSwitch]() {
+        statusAfterSwitch = manager.getFullSyncStatus();
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(statusAfterSwitch, FullSyncStatus::FullSyncFailed)
+        << "The full sync should be cancelled once the role is switched.";
+    EXPECT_FALSE(std::filesystem::exists(largeDestFile));
+}
+
+/*
+ * Test the full sync in progress is cancelled on request, the transfers are
+ * killed and the paths synced so far are kept to resume the full sync.
+ */
+TEST_F(ManagerTest, FullSyncCancelTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The bandwidth limit keeps the large file syncing for about 20 seconds
+    // while the small file is synced right away.
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/smallFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/smallDestFile"},
+           {"Description", "FullSync cancel test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/largeFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/largeDestFile"},
+           {"Description", "FullSync cancel test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"BandwidthLimit", 100}}}}};
+
+    std::string smallFile{jsonData["Files"][0]["Path"]};
+    std::string smallDestFile{jsonData["Files"][0]["DestinationPath"]};
+    std::string largeFile{jsonData["Files"][1]["Path"]};
+    std::string largeDestFile{jsonData["Files"][1]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    std::string data{"Data written on the file\n"};
+    ManagerTest::writeData(smallFile, data);
+    ManagerTest::writeData(largeFile, std::string(2 * 1024 * 1024, 'x'));
+
+    // Count the transfers spawned by this process which are not reaped yet.
+    auto transferCount = []() {
+        std::size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator("/proc"))
+        {
+            std::ifstream statFile(entry.path() / "stat");
+            std::string stat;
+            if (!std::getline(statFile, stat))
+            {
+                continue;
+            }
+            // The fields after the command are the state and the parent pid.
+            auto commEnd = stat.rfind(')');
+            auto commBegin = stat.find('(');
+            if (commBegin == std::string::npos || commEnd == std::string::npos)
+            {
+                continue;
+            }
+            std::istringstream fields(stat.substr(commEnd + 1));
+            std::string state;
+            pid_t parentPid = 0;
+            fields >> state >> parentPid;
+            if (parentPid == getpid() &&
+                stat.substr(commBegin + 1, commEnd - commBegin - 1) == "rsync")
+            {
+                ++count;
+            }
+        }
+        return count;
+    };
+
+    {
+        sdbusplus::async::context ctx;
+        data_sync::Manager manager{ctx, std::move(extDataIface),
+                                   ManagerTest::dataSyncCfgDir,
+                                   ManagerTest::dataSyncPersistDir};
+
+        ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+                  sdbusplus::async::execution::then(
+                      [&manager, &transferCount, &smallDestFile, &data]() {
+            EXPECT_EQ(manager.getFullSyncStatus(),
+                      FullSyncStatus::FullSyncInProgress);
+            EXPECT_EQ(ManagerTest::readData(smallDestFile), data);
+            EXPECT_GT(transferCount(), 0U);
+            EXPECT_TRUE(manager.cancelFullSync());
+        }));
+
+        ctx.spawn(sdbusplus::async::sleep_for(ctx, 1s) |
+                  sdbusplus::async::execution::then(
+                      [&ctx, &manager, &transferCount]() {
+            EXPECT_EQ(manager.getFullSyncStatus(),
+                      FullSyncStatus::FullSyncFailed);
+            EXPECT_TRUE(manager.isFullSyncCancelled());
+            EXPECT_EQ(transferCount(), 0U)
+                << "The transfer should be killed once cancelled.";
+
+            // Nothing to cancel once it is cancelled.
+            EXPECT_FALSE(manager.cancelFullSync());
+            ctx.request_stop();
+        }));
+        ctx.run();
+
+        EXPECT_FALSE(std::filesystem::exists(largeDestFile));
+    }
+
+    // The checkpoint keeps the path synced before the cancellation to
+    // resume from it, but not the cancelled one.
+    data_sync::ChangeJournal changeJournal{ManagerTest::dataSyncPersistDir /
+                                           "change.journal"};
+    data_sync::ChangeLog changeLog;
+    changeJournal.load(changeLog);
+    ASSERT_TRUE(changeJournal.fullSyncCheckpoint().has_value());
+    const auto& syncedPaths = changeJournal.fullSyncCheckpoint()->_syncedPaths;
+    EXPECT_TRUE(syncedPaths.contains(smallFile));
+    EXPECT_FALSE(syncedPaths.contains(largeFile));
+}
+
+/*
+ * Test the data changed while the daemon is down is synced once it is
+ * started again without the full sync of the same configuration.
+ */
+TEST_F(ManagerTest, FullSyncSkipOfflineChangeTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    auto makeExtDataIfaces = []() {
+        auto extDataIface = std::make_unique<ed::MockExternalDataIFaces>();
+        auto* mockExtDataIfaces = extDataIface.get();
+
+        ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+            // NOLINTNEXTLINE
+            .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+            mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+            mockExtDataIfaces->setBMCRedundancy(true);
+            co_return;
+        });
+
+        EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+            // NOLINTNEXTLINE
+            .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+        EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+            // NOLINTNEXTLINE
+            .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+        return std::unique_ptr<ed::ExternalDataIFaces>(std::move(extDataIface));
+    };
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile9"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile9"},
+           {"Description", "Offline change test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string srcFile{jsonData["Files"][0]["Path"]};
+    std::string destFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+
+    std::string data{"Data written on the file\n"};
+    ManagerTest::writeData(srcFile, data);
+    {
+        sdbusplus::async::context ctx;
+        data_sync::Manager manager{ctx, makeExtDataIfaces(),
+                                   ManagerTest::dataSyncCfgDir,
+                                   ManagerTest::dataSyncPersistDir};
+
+        ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+                  sdbusplus::async::execution::then(
+                      [&ctx]() { ctx.request_stop(); }));
+        ctx.run();
+
+        EXPECT_EQ(manager.getFullSyncStatus(),
+                  FullSyncStatus::FullSyncCompleted);
+        EXPECT_EQ(ManagerTest::readData(destFile), data);
+    }
+
+    // The fingerprint of the synced data is journaled on the shutdown.
+    {
+        data_sync::ChangeJournal changeJournal{
+            ManagerTest::dataSyncPersistDir / "change.journal"};
+        data_sync::ChangeLog changeLog;
+        changeJournal.load(changeLog);
+        ASSERT_TRUE(changeJournal.shutdownFingerprints().has_value());
+        EXPECT_TRUE(changeJournal.shutdownFingerprints()->contains(srcFile));
+    }
+
+    // Change the data while the daemon is down, it is not watched.
+    std::string offlineData{"Data written while the daemon is down\n"};
+    ManagerTest::writeData(srcFile, offlineData);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, makeExtDataIfaces(),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 0.5s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_NE(manager.getFullSyncStatus(), FullSyncStatus::FullSyncCompleted)
+        << "The full sync should be skipped as the changes are known.";
+    EXPECT_EQ(ManagerTest::readData(destFile), offlineData)
+        << "The data changed while the daemon is down should be synced.";
+}
+
+/*
+ * Test the progress of the full sync is emitted on the Dbus progress
+ * properties at the bounded rate and once it is finished.
+ */
+TEST_F(ManagerTest, FullSyncProgressPropertiesTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The bandwidth limit keeps the large file syncing for about 2 seconds
+    // after the small file is synced.
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/smallFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/smallDestFile"},
+           {"Description", "FullSync progress test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/largeFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/largeDestFile"},
+           {"Description", "FullSync progress test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"BandwidthLimit", 100}}}}};
+
+    std::string smallFile{jsonData["Files"][0]["Path"]};
+    std::string largeFile{jsonData["Files"][1]["Path"]};
+
+    writeConfig(jsonData);
+    std::string smallData{"Data written on the file\n"};
+    std::string largeData(200 * 1024, 'x');
+    ManagerTest::writeData(smallFile, smallData);
+    ManagerTest::writeData(largeFile, largeData);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // The small file is synced already, but the progress is not emitted
+    // until the emit interval is elapsed.
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+              sdbusplus::async::execution::then([&manager]() {
+        auto progress = manager.getFullSyncProgress();
+        EXPECT_EQ(progress._syncedCount, 0U);
+        EXPECT_EQ(progress._totalCount, 2U);
+        EXPECT_EQ(progress._transferredBytes, 0U);
+        EXPECT_FALSE(progress._eta.has_value());
+        EXPECT_FALSE(progress._resumed);
+    }));
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 1.5s) |
+              sdbusplus::async::execution::then([&manager, &smallData]() {
+        EXPECT_EQ(manager.getFullSyncStatus(),
+                  FullSyncStatus::FullSyncInProgress);
+        auto progress = manager.getFullSyncProgress();
+        EXPECT_EQ(progress._syncedCount, 1U);
+        EXPECT_EQ(progress._totalCount, 2U);
+        EXPECT_EQ(progress._transferredBytes, smallData.size());
+        EXPECT_GT(progress._throughput, 0U);
+        EXPECT_TRUE(progress._eta.has_value());
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 3.5s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(manager.getFullSyncStatus(), FullSyncStatus::FullSyncCompleted);
+    auto progress = manager.getFullSyncProgress();
+    EXPECT_EQ(progress._syncedCount, 2U);
+    EXPECT_EQ(progress._totalCount, 2U);
+    EXPECT_EQ(progress._transferredBytes, smallData.size() + largeData.size());
+    EXPECT_EQ(progress._eta, 0s);
+}
@@ -0,0 +1,670 @@
+#include "manager_test.hpp"
+
+#include <algorithm>
+#include <random>
+
+std::filesystem::path ManagerTest::dataSyncCfgDir;
+std::filesystem::path ManagerTest::tmpDataSyncDataDir;
+std::filesystem::path ManagerTest::dataSyncPersistDir;
+nlohmann::json ManagerTest::commonJsonData;
+
+namespace
+{
+
+/**
+ * @brief Count the file descriptors opened by the test process.
+ */
+std::size_t openFdCount()
+{
+    return static_cast<std::size_t>(std::ranges::distance(
+        std::filesystem::directory_iterator("/proc/self/fd")));
+}
+
+/**
+ * @brief Make the data which doesn't compress.
+ *
+ * @param[in] size - The size of the data
+ * @param[in] seed - The seed to make the different data
+ */
+std::string randomData(std::size_t size, unsigned int seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int> byte{'!', '~'};
+    std::string data(size, '\0');
+    std::ranges::generate(data, [&generator, &byte]() {
+        return static_cast<char>(byte(generator));
+    });
+    return data;
+}
+
+} // namespace
+
+TEST_F(ManagerTest, ImmediateSyncWatchReleasedOnRoleSwitchTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {{"Files", nlohmann::json::array()}};
+    constexpr std::size_t watchedCfgCount = 3;
+    for (std::size_t index = 0; index < watchedCfgCount; ++index)
+    {
+        auto srcFile = ManagerTest::tmpDataSyncDataDir.string() + "/srcFile" +
+                       std::to_string(index);
+        ManagerTest::writeData(srcFile, "Initial Data\n");
+        jsonData["Files"].push_back(
+            {{"Path", srcFile},
+             {"DestinationPath", srcFile + "-dest"},
+             {"Description", "Role switch watch test file"},
+             {"SyncDirection", "Active2Passive"},
+             {"SyncType", "Immediate"}});
+    }
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    std::size_t activeFdCount = 0;
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.2s) |
+              sdbusplus::async::execution::then(
+                  [&mockExtDataIfaces, &activeFdCount]() {
+        activeFdCount = openFdCount();
+        mockExtDataIfaces->changeBMCRole(ed::BMCRole::Passive);
+    }));
+
+    // The data isn't changed after the switch, hence the watches are
+    // released only if the wait is woken up by the stop request.
+    std::size_t passiveFdCount = 0;
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+              sdbusplus::async::execution::then([&passiveFdCount]() {
+        passiveFdCount = openFdCount();
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 0.7s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(activeFdCount - passiveFdCount, watchedCfgCount)
+        << "The inotify descriptor of each Active2Passive data should be"
+        << " closed once the BMC role is switched to Passive.";
+}
+
+TEST_F(ManagerTest, ImmediateSyncRenameReplaceTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile"},
+           {"Description", "Rename replace test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string srcFile{jsonData["Files"][0]["Path"]};
+    std::string destFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    ManagerTest::writeData(srcFile, "Initial Data\n");
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // The file is replaced twice as the watch of the replaced file is lost
+    // if the file itself is watched.
+    std::string data{"Data written on the replaced file\n"};
+    auto replaceFile = [&srcFile](const std::string& newData) {
+        ManagerTest::writeData(srcFile + ".tmp", newData);
+        std::filesystem::rename(srcFile + ".tmp", srcFile);
+    };
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.1s) |
+              sdbusplus::async::execution::then(
+                  [&replaceFile]() { replaceFile("Replaced Data\n"); }));
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+              sdbusplus::async::execution::then(
+                  [&replaceFile, &data]() { replaceFile(data); }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(ManagerTest::readData(destFile), data)
+        << "The file should be synced once it is replaced again.";
+}
+
+TEST_F(ManagerTest, ImmediateSyncLateCreateTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The directory and its parent are missing when the monitor starts.
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/late/srcDir/"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destDir/"},
+           {"Description", "Late create test directory"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string srcDir{jsonData["Directories"][0]["Path"]};
+    std::string destDir{jsonData["Directories"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    std::string data{"Data written in the subdirectory\n"};
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.1s) |
+              sdbusplus::async::execution::then([&srcDir]() {
+        std::filesystem::create_directories(srcDir + "subDir");
+    }));
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.5s) |
+              sdbusplus::async::execution::then([&srcDir, &data]() {
+        ManagerTest::writeData(srcDir + "subDir/file", data);
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(ManagerTest::readData(destDir + "subDir/file"), data)
+        << "The data created after the monitor starts should be synced"
+        << " along with the changes in its subdirectories.";
+}
+
+TEST_F(ManagerTest, ImmediateSyncDirChangeLogTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The directory is configured without the trailing separator and the
+    // sync fails as the parent of the destination is missing, hence the
+    // changes are kept pending.
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcDir"},
+           {"DestinationPath", ManagerTest::tmpDataSyncDataDir.string() +
+                                   "/missing/parent/destDir/"},
+           {"Description", "Directory change log test directory"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string srcDir{jsonData["Directories"][0]["Path"]};
+    std::filesystem::create_directory(srcDir);
+
+    writeConfig(jsonData);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.1s) |
+              sdbusplus::async::execution::then([&srcDir]() {
+        std::filesystem::create_directory(srcDir + "/subDir");
+    }));
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.3s) |
+              sdbusplus::async::execution::then([&srcDir]() {
+        for (const auto* file : {"/file1", "/file2", "/file3"})
+        {
+            ManagerTest::writeData(srcDir + "/subDir" + file, "Data\n");
+        }
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 0.6s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(manager.getPendingChanges(srcDir),
+              std::vector<std::string>{srcDir + "/subDir/"})
+        << "The changes in the created directory should be covered by the"
+        << " change of the directory.";
+}
+
+TEST_F(ManagerTest, ImmediateSyncDeadlineMissTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The bandwidth limit keeps the slow file syncing for about a second,
+    // which is beyond its latency, while the fast file is synced in time.
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/slowFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/slowDestFile"},
+           {"Description", "Deadline miss test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"MaxSyncLatency", "PT0.2S"},
+           {"BandwidthLimit", 100}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/fastFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/fastDestFile"},
+           {"Description", "Deadline miss test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"MaxSyncLatency", "PT5S"}}}}};
+
+    std::string slowFile{jsonData["Files"][0]["Path"]};
+    std::string slowDestFile{jsonData["Files"][0]["DestinationPath"]};
+    std::string fastFile{jsonData["Files"][1]["Path"]};
+    std::string fastDestFile{jsonData["Files"][1]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    ManagerTest::writeData(slowFile, "Initial Data\n");
+    ManagerTest::writeData(fastFile, "Initial Data\n");
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    std::string slowData(100 * 1024, 'x');
+    std::string fastData{"Data written on the file\n"};
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.1s) |
+              sdbusplus::async::execution::then(
+                  [&slowFile, &slowData, &fastFile, &fastData]() {
+        ManagerTest::writeData(slowFile, slowData);
+        ManagerTest::writeData(fastFile, fastData);
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 2s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(ManagerTest::readData(slowDestFile), slowData);
+    EXPECT_EQ(ManagerTest::readData(fastDestFile), fastData);
+    EXPECT_GE(manager.getDeadlineMisses(slowFile), 1U)
+        << "The sync which is finished after its latency should be counted"
+        << " as a deadline miss.";
+    EXPECT_EQ(manager.getDeadlineMisses(fastFile), 0U);
+}
+
+TEST_F(ManagerTest, ImmediateSyncRateLimitTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The compression is off to limit the data as it is written.
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile"},
+           {"Description", "Rate limit test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"Compression", "Off"}}}}};
+
+    std::string srcFile{jsonData["Files"][0]["Path"]};
+    std::string destFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    ManagerTest::writeData(srcFile, "Initial Data\n");
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // The 64 KiB takes about 2 seconds to transfer at 32 KiB/s and leaves
+    // the bucket in the debt of another 2 seconds without the burst.
+    std::string data1(64 * 1024, 'x');
+    std::string data2{"Data written after the first transfer\n"};
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.05s) |
+              sdbusplus::async::execution::then([&manager]() {
+        manager.setSyncRateLimit(32, 0, 0s);
+    }));
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.1s) |
+              sdbusplus::async::execution::then([&srcFile, &data1]() {
+        ManagerTest::writeData(srcFile, data1);
+    }));
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 1s) |
+              sdbusplus::async::execution::then([&destFile, &data1]() {
+        EXPECT_NE(ManagerTest::readData(destFile), data1)
+            << "The transfer should be throttled by the bandwidth limit.";
+    }));
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 2.5s) |
+              sdbusplus::async::execution::then([&srcFile, &data2]() {
+        ManagerTest::writeData(srcFile, data2);
+    }));
+
+    // Lift the limit while the next sync waits for the debt to be paid off,
+    // the waiting sync should follow the new limit without waiting for the
+    // old delay.
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 3s) |
+              sdbusplus::async::execution::then(
+                  [&manager, &destFile, &data1]() {
+        EXPECT_EQ(ManagerTest::readData(destFile), data1)
+            << "The next sync should wait for the debt of the transfer.";
+        manager.setSyncRateLimit(0, 0, 2s);
+    }));
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 3.5s) |
+              sdbusplus::async::execution::then(
+                  [&ctx, &destFile, &data2]() {
+        EXPECT_EQ(ManagerTest::readData(destFile), data2);
+        ctx.request_stop();
+    }));
+    ctx.run();
+}
+
+TEST_F(ManagerTest, ImmediateSyncCompressionDecisionTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile"},
+           {"Description", "Compression decision test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string srcFile{jsonData["Files"][0]["Path"]};
+    std::string destFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    ManagerTest::writeData(srcFile, "Initial Data\n");
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // The first transfer of the data is compressed to measure it, and the
+    // next ones are not as the data doesn't compress.
+    data_sync::CompressionPolicy::Stats initialStats;
+    std::string data;
+    for (unsigned int seed = 0; seed < 3; ++seed)
+    {
+        ctx.spawn(
+            sdbusplus::async::sleep_for(ctx, 0.1s + (seed * 0.5s)) |
+            sdbusplus::async::execution::then(
+                [&manager, &srcFile, &data, &initialStats, seed]() {
+            if (seed == 0)
+            {
+                initialStats = manager.getCompressionStats();
+            }
+            data = randomData(64 * 1024, seed);
+            ManagerTest::writeData(srcFile, data);
+        }));
+    }
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1.6s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(ManagerTest::readData(destFile), data);
+    const auto& stats = manager.getCompressionStats();
+    EXPECT_EQ(stats._compressedCount - initialStats._compressedCount, 1U);
+    EXPECT_EQ(stats._uncompressedCount - initialStats._uncompressedCount, 2U)
+        << "The data which doesn't compress should not be compressed once "
+        << "it is measured.";
+}
+
+TEST_F(ManagerTest, ImmediateSyncChunkBasisTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // The copy is synced to the other directory than the original, and its
+    // name and size differ from the original.
+    std::filesystem::create_directories(ManagerTest::tmpDataSyncDataDir / "copyDest");
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/origFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/origDestFile"},
+           {"Description", "Chunk basis test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/copyFile"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/copyDest/file"},
+           {"Description", "Chunk basis test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    std::string origFile{jsonData["Files"][0]["Path"]};
+    std::string copyFile{jsonData["Files"][1]["Path"]};
+    std::string copyDestFile{jsonData["Files"][1]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    ManagerTest::writeData(origFile, "Initial Data\n");
+    ManagerTest::writeData(copyFile, "Initial Data\n");
+    std::filesystem::remove(copyDestFile);
+
+    sdbusplus::async::context ctx;
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    std::string origData = randomData(256 * 1024, 0);
+    std::string copyData = "Inserted data\n" + origData;
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.1s) |
+              sdbusplus::async::execution::then([&origFile, &origData]() {
+        ManagerTest::writeData(origFile, origData);
+    }));
+
+    std::uint64_t initialMatchedBytes = 0;
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.6s) |
+              sdbusplus::async::execution::then(
+                  [&manager, &copyFile, &copyDestFile, &copyData,
+                   &initialMatchedBytes]() {
+        initialMatchedBytes = manager.getDedupStats()._matchedBytes;
+        std::filesystem::remove(copyDestFile);
+        ManagerTest::writeData(copyFile, copyData);
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1.2s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(ManagerTest::readData(copyDestFile), copyData);
+    EXPECT_GE(manager.getDedupStats()._matchedBytes - initialMatchedBytes,
+              origData.size() / 2)
+        << "The copy should be matched with the original as the basis.";
+
+    // The staged basis is removed once the transfer is finished.
+    for (const auto& entry : std::filesystem::directory_iterator(
+             ManagerTest::tmpDataSyncDataDir / "copyDest"))
+    {
+        EXPECT_FALSE(
+            entry.path().filename().string().starts_with(".data-sync-basis"))
+            << entry.path();
+    }
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iso_duration.hpp"
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <regex>
+#include <string>
+
+/**
+ * @brief The microbenchmark of the ISO 8601 duration parser against the
+ *        previous std::regex based implementation which is kept here as
+ *        the baseline.
+ *
+ *        Run it by "meson test --benchmark -C <builddir> --verbose".
+ */
+
+namespace
+{
+
+std::optional<std::chrono::seconds>
+    regexParser(const std::string& timeIntervalInISO)
+{
+    std::smatch match;
+    std::regex isoDurationRegex("PT(([0-9]+)H)?(([0-9]+)M)?(([0-9]+)S)?");
+
+    if (std::regex_search(timeIntervalInISO, match, isoDurationRegex))
+    {
+        return (std::chrono::seconds(
+            (match.str(2).empty() ? 0 : (std::stoi(match.str(2)) * 60 * 60)) +
+            (match.str(4).empty() ? 0 : (std::stoi(match.str(4)) * 60)) +
+            (match.str(6).empty() ? 0 : std::stoi(match.str(6)))));
+    }
+    return std::nullopt;
+}
+
+std::optional<std::chrono::seconds>
+    constexprParser(const std::string& timeIntervalInISO)
+{
+    auto duration = data_sync::config::parseISODuration(timeIntervalInISO);
+    if (!duration.has_value())
+    {
+        return std::nullopt;
+    }
+    return std::chrono::ceil<std::chrono::seconds>(*duration);
+}
+
+template <typename Parser>
+void run(std::string_view name, Parser parser)
+{
+    const std::array<std::string, 4> durations{"PT1M10S", "PT30S", "PT1H",
+                                               "PT2H30M15S"};
+    constexpr int iterations = 20000;
+
+    int64_t checksum = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        for (const auto& duration : durations)
+        {
+            checksum += parser(duration).value_or(std::chrono::seconds(0))
+                            .count();
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime);
+
+    std::cout << name << ": "
+              << elapsed.count() / (iterations * durations.size())
+              << " ns/parse (checksum " << checksum << ")\n";
+}
+
+} // namespace
+
+int main()
+{
+    run("std::regex parser", regexParser);
+    run("constexpr parser", constexprParser);
+    return 0;
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iso_duration.hpp"
+
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using data_sync::config::parseISODuration;
+using namespace std::chrono_literals;
+
+// The parser is usable at compile time.
+static_assert(parseISODuration("PT1M10S") == 70s);
+static_assert(!parseISODuration("P1Y").has_value());
+
+/*
+ * Test the supported ISO 8601 durations are parsed.
+ */
+TEST(ISODurationTest, TestValidDurations)
+{
+    EXPECT_EQ(parseISODuration("PT0S"), 0ms);
+    EXPECT_EQ(parseISODuration("PT30S"), 30s);
+    EXPECT_EQ(parseISODuration("PT1M"), 1min);
+    EXPECT_EQ(parseISODuration("PT1H"), 1h);
+    EXPECT_EQ(parseISODuration("PT1H1M1S"), 1h + 1min + 1s);
+    EXPECT_EQ(parseISODuration("PT90M"), 90min);
+    EXPECT_EQ(parseISODuration("P1D"), 24h);
+    EXPECT_EQ(parseISODuration("P1DT12H"), 36h);
+    EXPECT_EQ(parseISODuration("P2W"), 14 * 24h);
+    EXPECT_EQ(parseISODuration("PT0.5S"), 500ms);
+    EXPECT_EQ(parseISODuration("PT1,25S"), 1250ms);
+    EXPECT_EQ(parseISODuration("PT1.5H"), 90min);
+    EXPECT_EQ(parseISODuration("P0.5D"), 12h);
+    EXPECT_EQ(parseISODuration("PT1M0.001S"), 1min + 1ms);
+    EXPECT_EQ(parseISODuration("PT0.0001S"), 0ms);
+}
+
+/*
+ * Test the invalid and the unsupported ISO 8601 durations are rejected.
+ */
+TEST(ISODurationTest, TestInvalidDurations)
+{
+    for (const auto* duration :
+         {"", "P", "PT", "T1S", "1S", "P1", "PT1", "PS", "PTS", "P1DT",
+          "P1WT", "PT1S ", " PT1S", "XPT1S", "PT1SX", "PT-1S", "PT+1S",
+          "PT1.S", "PT.5S", "PT1.5M1S", "P1.5DT1H", "PT1S1M", "PT1H1H",
+          "P1DT1D", "PT1D", "P1H", "P1W1D", "P1WT1H", "PTT1S", "P1Y",
+          "P1M", "P1Y2M3DT4H", "PT1.5.5S"})
+    {
+        EXPECT_FALSE(parseISODuration(duration).has_value()) << duration;
+    }
+}
+
+/*
+ * Test the durations which overflow are rejected.
+ */
+TEST(ISODurationTest, TestOverflow)
+{
+    EXPECT_EQ(parseISODuration("PT9223372036854775S"),
+              std::chrono::seconds(9223372036854775));
+    EXPECT_FALSE(parseISODuration("PT9223372036854776S").has_value());
+    EXPECT_FALSE(parseISODuration("PT99999999999999999999S").has_value());
+    EXPECT_FALSE(parseISODuration("P15250284453W").has_value());
+    EXPECT_EQ(parseISODuration("PT9223372036854775.807S"),
+              std::chrono::milliseconds::max());
+    EXPECT_FALSE(parseISODuration("PT9223372036854775.808S").has_value());
+    EXPECT_FALSE(parseISODuration("P106751991167DT1000H").has_value());
+}
+
+/*
+ * Fuzz the parser with random inputs made of the characters of the format
+ * and check it never accepts an input outside the grammar, and the formatted
+ * durations are parsed back as is.
+ */
+TEST(ISODurationTest, TestFuzz)
+{
+    std::mt19937 generator(0x15008601);
+
+    constexpr std::string_view alphabet = "PTWDHMSY0123456789.,-";
+    std::uniform_int_distribution<std::size_t> charDist(0,
+                                                        alphabet.size() - 1);
+    std::uniform_int_distribution<std::size_t> lengthDist(0, 16);
+
+    for (int iteration = 0; iteration < 100000; ++iteration)
+    {
+        std::string input;
+        auto length = lengthDist(generator);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            input.push_back(alphabet[charDist(generator)]);
+        }
+
+        auto duration = parseISODuration(input);
+        if (duration.has_value())
+        {
+            EXPECT_GE(input.size(), 3U) << input;
+            EXPECT_EQ(input.front(), 'P') << input;
+            EXPECT_NE(input.back(), 'T') << input;
+            EXPECT_EQ(input.find_first_of("Y-"), std::string::npos) << input;
+            EXPECT_GE(duration->count(), 0) << input;
+        }
+    }
+
+    std::uniform_int_distribution<int64_t> valueDist(0, 100000);
+    for (int iteration = 0; iteration < 10000; ++iteration)
+    {
+        auto days = valueDist(generator);
+        auto hours = valueDist(generator);
+        auto minutes = valueDist(generator);
+        auto seconds = valueDist(generator);
+        auto millis = valueDist(generator) % 1000;
+
+        auto input = "P" + std::to_string(days) + "DT" + std::to_string(hours) +
+                     "H" + std::to_string(minutes) + "M" +
+                     std::to_string(seconds) + "." +
+                     std::to_string(1000 + millis).substr(1) + "S";
+
+        EXPECT_EQ(parseISODuration(input),
+                  std::chrono::days(days) + std::chrono::hours(hours) +
+                      std::chrono::minutes(minutes) +
+                      std::chrono::seconds(seconds) +
+                      std::chrono::milliseconds(millis))
+            << input;
+    }
+}
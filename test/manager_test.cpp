@@ -3,6 +3,7 @@
 
 std::filesystem::path ManagerTest::dataSyncCfgDir;
 std::filesystem::path ManagerTest::tmpDataSyncDataDir;
+std::filesystem::path ManagerTest::dataSyncPersistDir;
 nlohmann::json ManagerTest::commonJsonData;
 
 TEST_F(ManagerTest, ParseDataSyncCfg)
@@ -65,16 +66,249 @@ TEST_F(ManagerTest, ParseDataSyncCfg)
     sdbusplus::async::context ctx;
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     EXPECT_FALSE(
         manager.containsDataSyncCfg(ManagerTest::commonJsonData["Files"][0]));
 
+    // Wait for the configuration files to be parsed on the worker threads.
     ctx.spawn(
-        sdbusplus::async::sleep_for(ctx, 1ns) |
+        sdbusplus::async::sleep_for(ctx, 100ms) |
         sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
     ctx.run();
 
     EXPECT_TRUE(
         manager.containsDataSyncCfg(ManagerTest::commonJsonData["Files"][0]));
 }
+
+TEST_F(ManagerTest, ExpandPathTemplateCfg)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::filesystem::create_directory(ManagerTest::tmpDataSyncDataDir /
+                                      "host0-PersistData");
+    std::filesystem::create_directory(ManagerTest::tmpDataSyncDataDir /
+                                      "host1-PersistData");
+
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() +
+                        "/host{}-PersistData"},
+           {"Description", "Parse path template"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    writeConfig(jsonData);
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // Wait for the configuration files to be parsed on the worker threads.
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 100ms) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    auto instanceCfg = jsonData["Directories"][0];
+    EXPECT_FALSE(manager.containsDataSyncCfg(instanceCfg));
+
+    instanceCfg["Path"] = ManagerTest::tmpDataSyncDataDir.string() +
+                          "/host0-PersistData";
+    EXPECT_TRUE(manager.containsDataSyncCfg(instanceCfg));
+
+    instanceCfg["Path"] = ManagerTest::tmpDataSyncDataDir.string() +
+                          "/host1-PersistData";
+    EXPECT_TRUE(manager.containsDataSyncCfg(instanceCfg));
+}
+
+TEST_F(ManagerTest, RemovePathTemplateInstance)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::filesystem::create_directory(ManagerTest::tmpDataSyncDataDir /
+                                      "host0-PersistData");
+    std::filesystem::create_directory(ManagerTest::tmpDataSyncDataDir /
+                                      "host1-PersistData");
+
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() +
+                        "/host{}-PersistData"},
+           {"Description", "Remove path template instance"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    writeConfig(jsonData);
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    auto instanceCfg = jsonData["Directories"][0];
+    instanceCfg["Path"] = ManagerTest::tmpDataSyncDataDir.string() +
+                          "/host1-PersistData";
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 200ms) |
+              sdbusplus::async::execution::then([&manager, &instanceCfg]() {
+        EXPECT_TRUE(manager.containsDataSyncCfg(instanceCfg));
+        std::filesystem::remove(instanceCfg["Path"].get<std::string>());
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 400ms) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_FALSE(manager.containsDataSyncCfg(instanceCfg))
+        << "The removed instance should not be synced";
+
+    instanceCfg["Path"] = ManagerTest::tmpDataSyncDataDir.string() +
+                          "/host0-PersistData";
+    EXPECT_TRUE(manager.containsDataSyncCfg(instanceCfg));
+}
+
+TEST_F(ManagerTest, ReloadDataSyncCfg)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json removedCfg = {
+        {"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile1"},
+        {"DestinationPath",
+         ManagerTest::tmpDataSyncDataDir.string() + "/destFile1"},
+        {"Description", "Reload test removed file"},
+        {"SyncDirection", "Bidirectional"},
+        {"SyncType", "Periodic"},
+        {"Periodicity", "PT1S"}};
+
+    nlohmann::json addedCfg = {
+        {"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile2"},
+        {"DestinationPath",
+         ManagerTest::tmpDataSyncDataDir.string() + "/destFile2"},
+        {"Description", "Reload test added file"},
+        {"SyncDirection", "Bidirectional"},
+        {"SyncType", "Periodic"},
+        {"Periodicity", "PT1S"}};
+
+    std::string data{"Reload Data\n"};
+    ManagerTest::writeData(removedCfg["Path"].get<std::string>(), data);
+    ManagerTest::writeData(addedCfg["Path"].get<std::string>(), data);
+
+    writeConfig({{"Files", nlohmann::json::array({removedCfg})}});
+
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // Replace the configuration before the periodic sync of the removed file.
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 200ms) |
+              sdbusplus::async::execution::then([this, &manager, &removedCfg,
+                                                 &addedCfg]() {
+        EXPECT_TRUE(manager.containsDataSyncCfg(removedCfg));
+        writeConfig({{"Files", nlohmann::json::array({addedCfg})}});
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1.8s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_FALSE(manager.containsDataSyncCfg(removedCfg));
+    EXPECT_TRUE(manager.containsDataSyncCfg(addedCfg));
+
+    EXPECT_NE(ManagerTest::readData(
+                  removedCfg["DestinationPath"].get<std::string>()), data)
+        << "The removed configuration should not be synced";
+    EXPECT_EQ(ManagerTest::readData(
+                  addedCfg["DestinationPath"].get<std::string>()), data)
+        << "The added configuration should be synced periodically";
+}
+
+TEST_F(ManagerTest, LargeFileArgs)
+{
+    constexpr std::uintmax_t largeFileSize = 64 * 1024 * 1024;
+
+    // The file size, nullopt for a directory, and the expected arguments.
+    const std::vector<
+        std::pair<std::optional<std::uintmax_t>, std::vector<std::string>>>
+        argCases{
+            {std::nullopt, {"--exclude=.data-sync-partial/"}},
+            {0, {}},
+            {largeFileSize - 1, {}},
+            {largeFileSize,
+             {"--partial-dir=.data-sync-partial", "--block-size=131072"}},
+            {largeFileSize * 2,
+             {"--partial-dir=.data-sync-partial", "--block-size=131072"}},
+        };
+
+    for (const auto& [fileSize, args] : argCases)
+    {
+        SCOPED_TRACE(fileSize.has_value() ? std::to_string(*fileSize)
+                                          : std::string("directory"));
+        EXPECT_EQ(data_sync::Manager::largeFileArgs(fileSize), args);
+    }
+}
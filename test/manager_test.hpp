@@ -17,6 +17,8 @@ class ManagerTest : public ::testing::Test
         dataSyncCfgDir = mkdtemp(tmpdir);
         char tmpDataDir[] = "/tmp/pdsDataDirXXXXXX";
         tmpDataSyncDataDir = mkdtemp(tmpDataDir);
+        char tmpPersistDir[] = "/tmp/pdsPersistDirXXXXXX";
+        dataSyncPersistDir = mkdtemp(tmpPersistDir);
     }
 
     // Set up each individual test
@@ -28,11 +30,15 @@ class ManagerTest : public ::testing::Test
     // Tear down each individual test
     void TearDown() override
     {
-        // Remove each item from the directory
-        for (const auto& entry :
-             std::filesystem::directory_iterator(tmpDataSyncDataDir))
+        // Remove each item from the directories, the persisted data like
+        // the journal and the config cache is not carried over to the next
+        // test.
+        for (const auto& dir : {tmpDataSyncDataDir, dataSyncPersistDir})
         {
-            std::filesystem::remove_all(entry.path());
+            for (const auto& entry : std::filesystem::directory_iterator(dir))
+            {
+                std::filesystem::remove_all(entry.path());
+            }
         }
         std::filesystem::remove(dataSyncCfgFile);
     }
@@ -72,10 +78,12 @@ class ManagerTest : public ::testing::Test
         std::filesystem::remove(dataSyncCfgDir);
         std::filesystem::remove_all(tmpDataSyncDataDir);
         std::filesystem::remove(tmpDataSyncDataDir);
+        std::filesystem::remove_all(dataSyncPersistDir);
     }
 
     static std::filesystem::path dataSyncCfgDir;
     static nlohmann::json commonJsonData;
     static std::filesystem::path tmpDataSyncDataDir;
+    static std::filesystem::path dataSyncPersistDir;
     std::filesystem::path dataSyncCfgFile;
 };
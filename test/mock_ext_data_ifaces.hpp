@@ -24,6 +24,16 @@ class MockExternalDataIFaces : public ExternalDataIFaces
     {
         return this->bmcRedundancy(bmcRedundancy);
     }
+    void changeBMCRole(const BMCRole& role)
+    {
+        bmcRole(role);
+        redundancyPropsChanged();
+    }
+    void changeBMCRedundancy(const BMCRedundancy& bmcRedundancy)
+    {
+        this->bmcRedundancy(bmcRedundancy);
+        redundancyPropsChanged();
+    }
 };
 
 } // namespace data_sync::ext_data
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "path_pool.hpp"
+
+#include <gtest/gtest.h>
+
+using data_sync::config::PathPool;
+
+/*
+ * Test the paths are restored exactly as interned.
+ */
+TEST(PathPoolTest, RestorePaths)
+{
+    PathPool pathPool;
+
+    for (const auto* path :
+         {"/file/path/to/sync", "/directory/path/to/sync/", "relative/path",
+          "/repeated//separator", "/", "", "file"})
+    {
+        auto pathId = pathPool.intern(path);
+        EXPECT_EQ(pathPool.path(pathId), path);
+        EXPECT_EQ(pathPool.intern(path), pathId);
+        EXPECT_EQ(pathPool.find(path), pathId);
+    }
+
+    EXPECT_NE(pathPool.intern("/file/path"), pathPool.intern("/file/path/"));
+    EXPECT_NE(pathPool.intern("file"), pathPool.intern("/file"));
+}
+
+/*
+ * Test the common parent paths are interned only once.
+ */
+TEST(PathPoolTest, SharePrefixes)
+{
+    PathPool pathPool;
+
+    auto parentId = pathPool.intern("/var/lib/phosphor-data-sync");
+    auto pathCount = pathPool.size();
+
+    auto fileId = pathPool.intern("/var/lib/phosphor-data-sync/file1");
+    EXPECT_EQ(pathPool.size(), pathCount + 1);
+    EXPECT_EQ(pathPool.find("/var/lib/phosphor-data-sync"), parentId);
+
+    // The interned component is shared across the parent directories.
+    pathPool.intern("/var/lib/file1");
+    EXPECT_EQ(pathPool.size(), pathCount + 2);
+    EXPECT_EQ(pathPool.path(fileId), "/var/lib/phosphor-data-sync/file1");
+
+    EXPECT_EQ(pathPool.find("/var/lib/phosphor-data-sync/file2"),
+              PathPool::noPath);
+    EXPECT_EQ(pathPool.find("/var/lib/phosphor-data-sync/file1/"),
+              PathPool::noPath);
+}
+
+/*
+ * Test the paths stay valid once the lookup tables grow.
+ */
+TEST(PathPoolTest, GrowTables)
+{
+    PathPool pathPool;
+
+    std::vector<PathPool::PathId> pathIds;
+    for (int index = 0; index < 1000; ++index)
+    {
+        pathIds.push_back(pathPool.intern(
+            "/dir" + std::to_string(index % 10) + "/file" +
+            std::to_string(index)));
+    }
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        auto path = "/dir" + std::to_string(index % 10) + "/file" +
+                    std::to_string(index);
+        EXPECT_EQ(pathPool.find(path), pathIds[index]);
+        EXPECT_EQ(pathPool.path(pathIds[index]), path);
+    }
+}
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "path_template.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+
+class PathTemplateTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/pdsPathTemplateXXXXXX";
+        tmpDataDir = mkdtemp(tmpdir);
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(tmpDataDir);
+    }
+
+    nlohmann::json makeConfig(const std::string& path,
+                              const std::string& destPath) const
+    {
+        return {{"Path", (tmpDataDir / path).string()},
+                {"DestinationPath", (tmpDataDir / destPath).string()},
+                {"Description", "Path template test"},
+                {"SyncDirection", "Active2Passive"},
+                {"SyncType", "Immediate"},
+                {"ExcludeFilesList",
+                 {(tmpDataDir / path / "ignore").string()}}};
+    }
+
+    fs::path tmpDataDir;
+};
+
+/*
+ * Test the path template is expanded against the matching entries in
+ * the parent directory and the placeholder is replaced in all the paths.
+ */
+TEST_F(PathTemplateTest, ExpandAgainstFilesystem)
+{
+    using data_sync::config::DataSyncConfig;
+    using data_sync::config::PathTemplate;
+
+    fs::create_directory(tmpDataDir / "host0-PersistData");
+    fs::create_directory(tmpDataDir / "host1-PersistData");
+    fs::create_directory(tmpDataDir / "bmc-PersistData");
+    fs::create_directory(tmpDataDir / "host-PersistData");
+    fs::create_directory(tmpDataDir / "hostx-PersistData");
+    fs::create_directory(tmpDataDir / "host01-PersistData");
+
+    PathTemplate pathTemplate{DataSyncConfig(
+        makeConfig("host{}-PersistData", "dest/host{}-PersistData"))};
+
+    EXPECT_EQ(pathTemplate.parentDir(), tmpDataDir);
+
+    auto dataSyncCfgs = pathTemplate.expand();
+    ASSERT_EQ(dataSyncCfgs.size(), 2U);
+
+    std::ranges::sort(dataSyncCfgs, {}, &DataSyncConfig::_path);
+    EXPECT_EQ(dataSyncCfgs[0]._path,
+              (tmpDataDir / "host0-PersistData").string());
+    EXPECT_EQ(dataSyncCfgs[0]._destPath,
+              (tmpDataDir / "dest/host0-PersistData").string());
+    EXPECT_EQ(dataSyncCfgs[0]._excludeFileList.value()[0],
+              (tmpDataDir / "host0-PersistData/ignore").string());
+    EXPECT_EQ(dataSyncCfgs[1]._path,
+              (tmpDataDir / "host1-PersistData").string());
+}
+
+/*
+ * Test the expanded instances are cached and only the new instances are
+ * returned when the template is expanded again.
+ */
+TEST_F(PathTemplateTest, ExpandOnlyNewInstances)
+{
+    using data_sync::config::DataSyncConfig;
+    using data_sync::config::PathTemplate;
+
+    fs::create_directory(tmpDataDir / "host0-PersistData");
+
+    PathTemplate pathTemplate{
+        DataSyncConfig(makeConfig("host{}-PersistData", "host{}-Dest"))};
+
+    EXPECT_EQ(pathTemplate.expand().size(), 1U);
+    EXPECT_TRUE(pathTemplate.expand().empty());
+
+    fs::create_directory(tmpDataDir / "host1-PersistData");
+    auto dataSyncCfg = pathTemplate.expandEntry("host1-PersistData");
+    ASSERT_TRUE(dataSyncCfg.has_value());
+    EXPECT_EQ(dataSyncCfg->_path, (tmpDataDir / "host1-PersistData").string());
+
+    EXPECT_FALSE(pathTemplate.expandEntry("host1-PersistData").has_value());
+    EXPECT_FALSE(pathTemplate.expandEntry("host1-Other").has_value());
+    EXPECT_TRUE(pathTemplate.expand().empty());
+
+    auto instanceCfgs = pathTemplate.instances();
+    ASSERT_EQ(instanceCfgs.size(), 2U);
+    EXPECT_EQ(instanceCfgs[0]._path,
+              (tmpDataDir / "host0-PersistData").string());
+    EXPECT_EQ(instanceCfgs[1]._destPath,
+              (tmpDataDir / "host1-Dest").string());
+}
+
+/*
+ * Test the removed instance is dropped and expanded again once it appears
+ * again.
+ */
+TEST_F(PathTemplateTest, RemoveInstance)
+{
+    using data_sync::config::DataSyncConfig;
+    using data_sync::config::PathTemplate;
+
+    fs::create_directory(tmpDataDir / "host0-PersistData");
+    fs::create_directory(tmpDataDir / "host1-PersistData");
+
+    PathTemplate pathTemplate{
+        DataSyncConfig(makeConfig("host{}-PersistData", "host{}-Dest"))};
+    EXPECT_EQ(pathTemplate.expand().size(), 2U);
+
+    auto dataSyncCfg = pathTemplate.removeEntry("host1-PersistData");
+    ASSERT_TRUE(dataSyncCfg.has_value());
+    EXPECT_EQ(dataSyncCfg->_path, (tmpDataDir / "host1-PersistData").string());
+    EXPECT_EQ(dataSyncCfg->_destPath, (tmpDataDir / "host1-Dest").string());
+
+    EXPECT_FALSE(pathTemplate.removeEntry("host1-PersistData").has_value());
+    EXPECT_FALSE(pathTemplate.removeEntry("host2-PersistData").has_value());
+    ASSERT_EQ(pathTemplate.instances().size(), 1U);
+    EXPECT_EQ(pathTemplate.instances()[0]._path,
+              (tmpDataDir / "host0-PersistData").string());
+
+    EXPECT_TRUE(pathTemplate.expandEntry("host1-PersistData").has_value());
+}
+
+/*
+ * Test the path template is expanded against the host instance count.
+ */
+TEST_F(PathTemplateTest, ExpandAgainstHostInstances)
+{
+    using data_sync::config::DataSyncConfig;
+    using data_sync::config::PathTemplate;
+
+    PathTemplate pathTemplate{
+        DataSyncConfig(makeConfig("host{}/data", "dest/host{}/data"))};
+
+    auto dataSyncCfgs = pathTemplate.expand(2);
+    ASSERT_EQ(dataSyncCfgs.size(), 2U);
+    EXPECT_EQ(dataSyncCfgs[0]._path, (tmpDataDir / "host0/data").string());
+    EXPECT_EQ(dataSyncCfgs[1]._destPath,
+              (tmpDataDir / "dest/host1/data").string());
+
+    EXPECT_EQ(pathTemplate.expand(3).size(), 1U);
+}
+
+/*
+ * Test the path with more than one placeholder in a path component is
+ * rejected.
+ */
+TEST_F(PathTemplateTest, InvalidPathTemplate)
+{
+    using data_sync::config::DataSyncConfig;
+    using data_sync::config::PathTemplate;
+
+    EXPECT_THROW(PathTemplate{DataSyncConfig(
+                     makeConfig("host{}-{}-PersistData", "host{}"))},
+                 std::invalid_argument);
+}
@@ -2,6 +2,7 @@
 
 std::filesystem::path ManagerTest::dataSyncCfgDir;
 std::filesystem::path ManagerTest::tmpDataSyncDataDir;
+std::filesystem::path ManagerTest::dataSyncPersistDir;
 nlohmann::json ManagerTest::commonJsonData;
 
 TEST_F(ManagerTest, PeriodicDataSyncTest)
@@ -49,7 +50,8 @@ TEST_F(ManagerTest, PeriodicDataSyncTest)
     ASSERT_EQ(ManagerTest::readData(srcFile), data);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     EXPECT_NE(ManagerTest::readData(destFile), data)
         << "The data should not match because the manager is spawned and "
@@ -118,7 +120,8 @@ TEST_F(ManagerTest, PeriodicDataSyncDelayFileTest)
     ASSERT_NE(ManagerTest::readData(srcFile), data);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     EXPECT_NE(ManagerTest::readData(destFile), data)
         << "The data should not match because the source data is "
@@ -191,7 +194,8 @@ TEST_F(ManagerTest, PeriodicDataSyncMultiRWTest)
     ASSERT_EQ(ManagerTest::readData(srcFile), data);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
 
     EXPECT_NE(ManagerTest::readData(destFile), data)
         << "The data should not match because the manager is spawned and"
@@ -266,7 +270,8 @@ TEST_F(ManagerTest, PeriodicDataSyncP2ATest)
     ASSERT_EQ(ManagerTest::readData(srcFile), data);
 
     data_sync::Manager manager{ctx, std::move(extDataIface),
-                               ManagerTest::dataSyncCfgDir};
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
     EXPECT_NE(ManagerTest::readData(destFile), data)
         << "The data should not match because the manager is spawned and"
         << "is waiting for the periodic interval to initiate the sync.";
@@ -280,3 +285,149 @@ TEST_F(ManagerTest, PeriodicDataSyncP2ATest)
         << "The sync direction is from Passive to Active, mocks the role"
         << " as Passive and verifies that the data matches from the P-BMC.";
 }
+
+TEST_F(ManagerTest, PeriodicDataSyncRoleSwitchTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile4"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile4"},
+           {"Description", "Role switch test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1S"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile5"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile5"},
+           {"Description", "Role switch test file"},
+           {"SyncDirection", "Passive2Active"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1S"}}}}};
+
+    std::string activeSrcFile{jsonData["Files"][0]["Path"]};
+    std::string activeDestFile{jsonData["Files"][0]["DestinationPath"]};
+    std::string passiveSrcFile{jsonData["Files"][1]["Path"]};
+    std::string passiveDestFile{jsonData["Files"][1]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    std::string data{"Initial Data\n"};
+    ManagerTest::writeData(activeSrcFile, data);
+    ManagerTest::writeData(passiveSrcFile, data);
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    // Switch the role before the periodic sync of the Active BMC data.
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.2s) |
+              sdbusplus::async::execution::then([&mockExtDataIfaces]() {
+        mockExtDataIfaces->changeBMCRole(ed::BMCRole::Passive);
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 1.5s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_NE(ManagerTest::readData(activeDestFile), data)
+        << "The Active2Passive data should not sync once the BMC role is"
+        << " switched to Passive.";
+    EXPECT_EQ(ManagerTest::readData(passiveDestFile), data)
+        << "The Passive2Active data should sync periodically once the BMC"
+        << " role is switched to Passive.";
+}
+
+TEST_F(ManagerTest, PeriodicDataSyncRoleSwitchResyncTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Passive);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchSiblingBmcIP())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchRbmcCredentials())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile6"},
+           {"DestinationPath",
+            ManagerTest::tmpDataSyncDataDir.string() + "/destFile6"},
+           {"Description", "Role switch resync test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT10S"}}}}};
+
+    std::string srcFile{jsonData["Files"][0]["Path"]};
+    std::string destFile{jsonData["Files"][0]["DestinationPath"]};
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    std::string data{"Initial Data\n"};
+    ManagerTest::writeData(srcFile, data);
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir,
+                               ManagerTest::dataSyncPersistDir};
+
+    ctx.spawn(sdbusplus::async::sleep_for(ctx, 0.2s) |
+              sdbusplus::async::execution::then(
+                  [&mockExtDataIfaces, &destFile, &data]() {
+        EXPECT_NE(ManagerTest::readData(destFile), data)
+            << "The Active2Passive data should not sync in the Passive role.";
+        mockExtDataIfaces->changeBMCRole(ed::BMCRole::Active);
+    }));
+
+    ctx.spawn(
+        sdbusplus::async::sleep_for(ctx, 0.7s) |
+        sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
+    ctx.run();
+
+    EXPECT_EQ(ManagerTest::readData(destFile), data)
+        << "The data which is never confirmed synced should be synced once"
+        << " the BMC role is switched without waiting for the periodicity.";
+}
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_plan.hpp"
+
+#include <gtest/gtest.h>
+
+using data_sync::SyncPlan;
+using data_sync::config::ConfigStore;
+using data_sync::config::DataSyncConfig;
+using data_sync::config::SyncType;
+using data_sync::ext_data::BMCRole;
+
+namespace
+{
+
+DataSyncConfig makeConfig(const std::string& path,
+                          const std::string& syncDirection,
+                          const std::string& syncType)
+{
+    nlohmann::json cfg = {{"Path", path},
+                          {"Description", "Sync plan test"},
+                          {"SyncDirection", syncDirection},
+                          {"SyncType", syncType}};
+    if (syncType == "Periodic")
+    {
+        cfg["Periodicity"] = "PT1M";
+    }
+    return DataSyncConfig(cfg);
+}
+
+} // namespace
+
+/*
+ * Test the configurations are planned by the BMC role and grouped by the sync
+ * type in the configured order.
+ */
+TEST(SyncPlanTest, PlanByRole)
+{
+    ConfigStore configStore{std::vector<DataSyncConfig>{
+        makeConfig("/file/path/to/sync0", "Active2Passive", "Immediate"),
+        makeConfig("/file/path/to/sync1", "Passive2Active", "Immediate"),
+        makeConfig("/file/path/to/sync2", "Bidirectional", "Periodic"),
+        makeConfig("/file/path/to/sync3", "Bidirectional", "Immediate"),
+        makeConfig("/file/path/to/sync4", "Active2Passive", "Periodic")}};
+
+    SyncPlan activePlan{configStore, BMCRole::Active};
+    EXPECT_EQ(activePlan.bmcRole(), BMCRole::Active);
+    EXPECT_EQ(activePlan.cfgs(SyncType::Immediate),
+              (std::vector<std::uint32_t>{0, 3}));
+    EXPECT_EQ(activePlan.cfgs(SyncType::Periodic),
+              (std::vector<std::uint32_t>{2, 4}));
+    EXPECT_EQ(activePlan.size(), 4U);
+
+    SyncPlan passivePlan{configStore, BMCRole::Passive};
+    EXPECT_EQ(passivePlan.cfgs(SyncType::Immediate),
+              (std::vector<std::uint32_t>{1, 3}));
+    EXPECT_EQ(passivePlan.cfgs(SyncType::Periodic),
+              (std::vector<std::uint32_t>{2}));
+
+    // Only the bidirectional data is synced until the role is known.
+    SyncPlan unknownPlan{configStore, BMCRole::Unknown};
+    EXPECT_EQ(unknownPlan.cfgs(SyncType::Immediate),
+              (std::vector<std::uint32_t>{3}));
+    EXPECT_EQ(unknownPlan.cfgs(SyncType::Periodic),
+              (std::vector<std::uint32_t>{2}));
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+using data_sync::SyncScheduler;
+using namespace std::literals;
+
+namespace
+{
+
+data_sync::config::DataSyncConfig makeConfig(const std::string& path)
+{
+    return data_sync::config::DataSyncConfig(
+        {{"Path", path},
+         {"Description", "Sync scheduler test"},
+         {"SyncDirection", "Active2Passive"},
+         {"SyncType", "Immediate"}});
+}
+
+} // namespace
+
+/*
+ * Test the pending syncs are started in the order of their deadlines and
+ * the concurrent syncs are bounded.
+ */
+TEST(SyncSchedulerTest, EarliestDeadlineFirst)
+{
+    SyncScheduler scheduler{2};
+    auto now = SyncScheduler::Clock::now();
+    scheduler.submit(makeConfig("/path/to/bulk"), now + 10s);
+    scheduler.submit(makeConfig("/path/to/periodic"), now + 5s);
+    scheduler.submit(makeConfig("/path/to/urgent"), now + 1s);
+    EXPECT_EQ(scheduler.pendingCount(), 3U);
+
+    auto urgentJob = scheduler.start();
+    ASSERT_TRUE(urgentJob.has_value());
+    EXPECT_EQ(urgentJob->_dataSyncCfg._path, "/path/to/urgent");
+
+    auto periodicJob = scheduler.start();
+    ASSERT_TRUE(periodicJob.has_value());
+    EXPECT_EQ(periodicJob->_dataSyncCfg._path, "/path/to/periodic");
+
+    // The limit is reached, hence the bulk sync waits.
+    EXPECT_FALSE(scheduler.start().has_value());
+    EXPECT_EQ(scheduler.runningCount(), 2U);
+
+    // The urgent sync goes ahead of the queued bulk sync.
+    scheduler.submit(makeConfig("/path/to/urgent"), now + 2s);
+    EXPECT_FALSE(scheduler.finish(*urgentJob, now));
+    auto nextJob = scheduler.start();
+    ASSERT_TRUE(nextJob.has_value());
+    EXPECT_EQ(nextJob->_dataSyncCfg._path, "/path/to/urgent");
+    EXPECT_EQ(nextJob->_deadline, now + 2s);
+    EXPECT_EQ(scheduler.pendingCount(), 1U);
+}
+
+/*
+ * Test the pending sync which is submitted again is coalesced into a single
+ * sync by the earliest deadline.
+ */
+TEST(SyncSchedulerTest, CoalescePendingSync)
+{
+    SyncScheduler scheduler{1};
+    auto now = SyncScheduler::Clock::now();
+    scheduler.submit(makeConfig("/path/to/sync"), now + 5s);
+    scheduler.submit(makeConfig("/path/to/other"), now + 3s);
+    scheduler.submit(makeConfig("/path/to/sync"), now + 1s);
+    scheduler.submit(makeConfig("/path/to/sync"), now + 8s);
+    EXPECT_EQ(scheduler.pendingCount(), 2U);
+
+    auto job = scheduler.start();
+    ASSERT_TRUE(job.has_value());
+    EXPECT_EQ(job->_dataSyncCfg._path, "/path/to/sync");
+    EXPECT_EQ(job->_deadline, now + 1s);
+    EXPECT_EQ(scheduler.pendingCount(), 1U);
+}
+
+/*
+ * Test the syncs which are finished after their deadline are counted per
+ * path.
+ */
+TEST(SyncSchedulerTest, DeadlineMisses)
+{
+    SyncScheduler scheduler{1};
+    auto now = SyncScheduler::Clock::now();
+    scheduler.submit(makeConfig("/path/to/sync"), now + 1s);
+
+    auto job = scheduler.start();
+    ASSERT_TRUE(job.has_value());
+    EXPECT_TRUE(scheduler.finish(*job, now + 2s));
+    EXPECT_EQ(scheduler.runningCount(), 0U);
+    EXPECT_EQ(scheduler.deadlineMisses("/path/to/sync"), 1U);
+
+    scheduler.submit(makeConfig("/path/to/sync"), now + 3s);
+    job = scheduler.start();
+    ASSERT_TRUE(job.has_value());
+    EXPECT_FALSE(scheduler.finish(*job, now + 3s));
+    EXPECT_EQ(scheduler.deadlineMisses("/path/to/sync"), 1U);
+    EXPECT_EQ(scheduler.deadlineMisses("/path/to/other"), 0U);
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "token_bucket.hpp"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using data_sync::TokenBucket;
+using namespace std::literals;
+
+/*
+ * Test the burst is allowed at once and the debt delays the next transfer
+ * until it is refilled.
+ */
+TEST(TokenBucketTest, BurstAndDebt)
+{
+    auto now = TokenBucket::Clock::now();
+    TokenBucket bucket{1000, 2000, now};
+    EXPECT_EQ(bucket.delay(now), 0s);
+
+    bucket.consume(1500, now);
+    EXPECT_EQ(bucket.delay(now), 0s);
+
+    // The transfer may consume more than available and leave the debt.
+    bucket.consume(1500, now);
+    EXPECT_EQ(bucket.delay(now), 1s);
+    EXPECT_EQ(bucket.delay(now + 500ms), 500ms);
+    EXPECT_EQ(bucket.delay(now + 1s), 0s);
+
+    // The tokens are not accumulated beyond the burst while idle.
+    bucket.consume(2500, now + 10s);
+    EXPECT_EQ(bucket.delay(now + 10s), 500ms);
+}
+
+/*
+ * Test the bucket of no rate doesn't limit and the rate is adjusted at
+ * runtime.
+ */
+TEST(TokenBucketTest, AdjustRate)
+{
+    auto now = TokenBucket::Clock::now();
+    TokenBucket bucket{0, 0, now};
+    bucket.consume(1'000'000, now);
+    EXPECT_EQ(bucket.delay(now), 0s);
+
+    // The bucket which was not limited starts full.
+    bucket.configure(100, 100, now);
+    EXPECT_EQ(bucket.rate(), 100U);
+    EXPECT_EQ(bucket.burst(), 100U);
+    bucket.consume(300, now);
+    EXPECT_EQ(bucket.delay(now), 2s);
+
+    // The debt is kept and paid off at the new rate.
+    bucket.configure(200, 200, now);
+    EXPECT_EQ(bucket.delay(now), 1s);
+
+    bucket.configure(0, 0, now);
+    EXPECT_EQ(bucket.delay(now), 0s);
+}
+
+/*
+ * Test the amounts of the limits are multiplied without the overflow.
+ */
+TEST(TokenBucketTest, CheckedMul)
+{
+    constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_EQ(TokenBucket::checkedMul(1024, 10), 10240U);
+    EXPECT_EQ(TokenBucket::checkedMul(max, 0), 0U);
+    EXPECT_EQ(TokenBucket::checkedMul(max, 1), max);
+    EXPECT_EQ(TokenBucket::checkedMul(max / 1024 + 1, 1024), std::nullopt);
+    EXPECT_EQ(TokenBucket::checkedMul(max, 2), std::nullopt);
+}
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "transfer_priority.hpp"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace transfer = data_sync::transfer;
+
+/*
+ * Test the CPU list is parsed with the ranges and the invalid list is
+ * rejected.
+ */
+TEST(TransferPriorityTest, ParseCpuList)
+{
+    auto cpuSet = transfer::parseCpuList("0-2,5");
+    ASSERT_TRUE(cpuSet.has_value());
+    EXPECT_EQ(CPU_COUNT(&*cpuSet), 4);
+    EXPECT_TRUE(CPU_ISSET(1, &*cpuSet));
+    EXPECT_TRUE(CPU_ISSET(5, &*cpuSet));
+    EXPECT_FALSE(CPU_ISSET(3, &*cpuSet));
+
+    EXPECT_FALSE(transfer::parseCpuList("").has_value());
+    EXPECT_FALSE(transfer::parseCpuList("2-1").has_value());
+    EXPECT_FALSE(transfer::parseCpuList("0,").has_value());
+    EXPECT_FALSE(transfer::parseCpuList("a").has_value());
+}
+
+/*
+ * Test the priority is applied to the calling process, it is checked in
+ * a child process to not change the priority of the test.
+ */
+TEST(TransferPriorityTest, ApplyPriority)
+{
+    auto cpuSet = transfer::parseCpuList("0");
+    ASSERT_TRUE(cpuSet.has_value());
+
+    transfer::Priority priority;
+    priority._nice = 19;
+    priority._ioClass = transfer::IOClass::Idle;
+    priority._cpuAffinity = cpuSet;
+
+    auto childPid = fork();
+    ASSERT_GE(childPid, 0);
+    if (childPid == 0)
+    {
+        transfer::applyPriority(priority, -1);
+
+        cpu_set_t affinity;
+        CPU_ZERO(&affinity);
+        sched_getaffinity(0, sizeof(affinity), &affinity);
+        _exit(getpriority(PRIO_PROCESS, 0) == 19 &&
+                      CPU_EQUAL(&affinity, &*cpuSet)
+                  ? 0
+                  : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(childPid, &status, 0), childPid);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+/*
+ * Test the priority is applied to the calling thread only, as the workers
+ * hashing the data are deprioritized like the transfers.
+ */
+TEST(TransferPriorityTest, ApplyThreadPriority)
+{
+    auto daemonNice = getpriority(PRIO_PROCESS, 0);
+
+    transfer::Priority priority;
+    priority._nice = 19;
+
+    int workerNice = 0;
+    std::thread worker{[&priority, &workerNice]() {
+        transfer::applyThreadPriority(priority);
+        workerNice = getpriority(PRIO_PROCESS, 0);
+    }};
+    worker.join();
+
+    EXPECT_EQ(workerNice, 19);
+    EXPECT_EQ(getpriority(PRIO_PROCESS, 0), daemonNice);
+}
+
+/*
+ * Test the transfer cgroup is created with the cgroup.procs file.
+ */
+TEST(TransferPriorityTest, SetupCgroup)
+{
+    auto cgroup = std::filesystem::temp_directory_path() /
+                  "transfer_priority_test" / "transfer";
+    std::filesystem::remove_all(cgroup.parent_path());
+
+    auto cgroupProcs = transfer::setupCgroup(cgroup, 100, 200);
+    ASSERT_TRUE(cgroupProcs.has_value());
+    EXPECT_EQ(*cgroupProcs, (cgroup / "cgroup.procs").string());
+    EXPECT_TRUE(std::filesystem::exists(cgroup / "cpu.weight"));
+
+    std::filesystem::remove_all(cgroup.parent_path());
+}
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "worker.hpp"
+
+#include <sdbusplus/async/context.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+/*
+ * Test the job is run on another thread and its result is returned to the
+ * event loop.
+ */
+TEST(WorkerTest, RunInWorker)
+{
+    sdbusplus::async::context ctx;
+
+    std::thread::id jobThreadId;
+    std::size_t result = 0;
+    // NOLINTNEXTLINE
+    auto runJob = [&]() -> sdbusplus::async::task<> {
+        result = co_await data_sync::runInWorker(ctx, [&jobThreadId]() {
+            jobThreadId = std::this_thread::get_id();
+            return std::size_t{42};
+        });
+        ctx.request_stop();
+        co_return;
+    };
+    ctx.spawn(runJob());
+    ctx.run();
+
+    EXPECT_EQ(result, 42U);
+    EXPECT_NE(jobThreadId, std::this_thread::get_id());
+}